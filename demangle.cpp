@@ -0,0 +1,129 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/demangle.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/demangle.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Cache of demangled symbols (never deleted: may be used during static destruction) */
+struct tDemangleCache
+{
+  std::shared_mutex mutex;
+
+  /*! Demangled names by address of mangled symbol */
+  std::unordered_map<const char*, std::string_view> names;
+
+  /*! Storage for demangled names (deque: elements never move) */
+  std::deque<std::string> storage;
+};
+
+tDemangleCache& GetDemangleCache()
+{
+  static tDemangleCache* cache = new tDemangleCache();
+  return *cache;
+}
+
+}
+
+std::string_view DemangleCached(const char *symbol)
+{
+  tDemangleCache& cache = GetDemangleCache();
+  {
+    std::shared_lock<std::shared_mutex> lock(cache.mutex);
+    auto it = cache.names.find(symbol);
+    if (it != cache.names.end())
+    {
+      return it->second;
+    }
+  }
+
+  // demangle without lock (no thread_local buffer: this function may be called during static destruction)
+  int status = 0;
+  char *demangled = abi::__cxa_demangle(symbol, nullptr, nullptr, &status);
+  std::string name((status == 0 && demangled) ? demangled : symbol);
+  free(demangled);
+
+  std::unique_lock<std::shared_mutex> lock(cache.mutex);
+  auto it = cache.names.find(symbol);
+  if (it == cache.names.end())
+  {
+    cache.storage.emplace_back(std::move(name));
+    it = cache.names.emplace(symbol, std::string_view(cache.storage.back())).first;
+  }
+  return it->second;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
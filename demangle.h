@@ -39,6 +39,12 @@
  *
  * This function abstracts from the different ways of demangling,
  * starting with support for GCC.
+ *
+ * Demangling is expensive and - with abi::__cxa_demangle - requires a
+ * heap allocation per call. Code that demangles the same symbols
+ * repeatedly (e.g. RTTI names in type registries or function names in
+ * backtraces) should use DemangleCached, which demangles every symbol
+ * only once. tDemangleBuffer reuses a buffer across calls.
  */
 //----------------------------------------------------------------------
 #ifndef __rrlib__util__demangle_h__
@@ -48,11 +54,15 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <string>
+#include <string_view>
+#include <cstdlib>
+#include <cstring>
 #include <cxxabi.h>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -74,6 +84,60 @@ namespace util
 // Function declaration
 //----------------------------------------------------------------------
 
+//! Demangler with reusable buffer
+/*!
+ * Demangles symbols into a buffer that is reused (and grown if necessary)
+ * across calls - so that no allocation is required in the common case.
+ * Not thread-safe - use one object per thread.
+ */
+class tDemangleBuffer : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tDemangleBuffer() :
+    buffer(nullptr),
+    buffer_size(0)
+  {}
+
+  ~tDemangleBuffer()
+  {
+    free(buffer);
+    buffer = nullptr;
+    buffer_size = 0;
+  }
+
+  /*!
+   * \param symbol   The mangled symbol as returned e.g. from RTTI
+   *
+   * \return The demangled name (valid until next call) if demangling was
+   *         possible, the original symbol otherwise
+   */
+  std::string_view Demangle(const char *symbol)
+  {
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(symbol, this->buffer, &this->buffer_size, &status);
+    if (status == 0 && demangled)
+    {
+      this->buffer = demangled;
+      return std::string_view(demangled);
+    }
+    return std::string_view(symbol);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Buffer allocated with malloc (as required by abi::__cxa_demangle) */
+  char *buffer;
+  size_t buffer_size;
+};
+
 /*! This function abstracts from the different ways of demangling.
  *
  * \param symbol   The mangled symbol as returned e.g. from RTTI
@@ -94,6 +158,19 @@ inline std::string Demangle(const std::string &symbol)
   return result;
 }
 
+/*! Demangles symbol once and returns the cached result on subsequent calls.
+ *
+ * The cache is keyed on the address of the symbol - so this is intended
+ * for symbols with static storage duration (e.g. std::type_info::name()
+ * or symbol tables of loaded binaries). Thread-safe.
+ *
+ * \param symbol   The mangled symbol as returned e.g. from RTTI
+ *
+ * \return The demangled type name if demangling was possible,
+ *         the original symbol otherwise (valid until the process terminates)
+ */
+std::string_view DemangleCached(const char *symbol);
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
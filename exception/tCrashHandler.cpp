@@ -0,0 +1,578 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/exception/tCrashHandler.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/exception/tCrashHandler.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#if __linux__
+#include <execinfo.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <ucontext.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/exception/tSymbolizer.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tCrashHandler::cMAX_FRAMES;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+#if __linux__
+namespace
+{
+
+const int cSIGNALS[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+const size_t cSIGNAL_COUNT = sizeof(cSIGNALS) / sizeof(cSIGNALS[0]);
+const size_t cMAX_PATH_LENGTH = 256;
+
+// Everything the signal handler uses is allocated statically
+struct sigaction previous_actions[cSIGNAL_COUNT];
+bool installed = false;
+char record_file_path[4096];
+std::atomic<long> handling_thread(0);
+void* frames[tCrashHandler::cMAX_FRAMES + 1];
+uintptr_t frame_offsets[tCrashHandler::cMAX_FRAMES];
+char frame_paths[tCrashHandler::cMAX_FRAMES][cMAX_PATH_LENGTH];
+char maps_buffer[4096];
+char maps_line[cMAX_PATH_LENGTH + 128];
+
+/*! Async-signal-safe output to stderr and record file */
+class tRecordWriter
+{
+public:
+
+  tRecordWriter(int record_file) : record_file(record_file)
+  {}
+
+  void Write(const char* data, size_t length)
+  {
+    WriteFully(STDERR_FILENO, data, length);
+    if (record_file >= 0 && record_file != STDERR_FILENO)  // stderr might have been closed
+    {
+      WriteFully(record_file, data, length);
+    }
+  }
+
+  tRecordWriter& operator<<(const char* string)
+  {
+    Write(string, strlen(string));
+    return *this;
+  }
+
+  tRecordWriter& Decimal(unsigned long long value)
+  {
+    char buffer[24];
+    char* position = buffer + sizeof(buffer);
+    do
+    {
+      *--position = static_cast<char>('0' + value % 10);
+      value /= 10;
+    }
+    while (value);
+    Write(position, buffer + sizeof(buffer) - position);
+    return *this;
+  }
+
+  tRecordWriter& Hex(uintptr_t value, size_t digits)
+  {
+    char buffer[2 + 2 * sizeof(uintptr_t)];
+    char* position = buffer + sizeof(buffer);
+    size_t written = 0;
+    do
+    {
+      *--position = "0123456789abcdef"[value & 0xF];
+      value >>= 4;
+      written++;
+    }
+    while ((value || written < digits) && position > buffer + 2);
+    *--position = 'x';
+    *--position = '0';
+    Write(position, buffer + sizeof(buffer) - position);
+    return *this;
+  }
+
+private:
+
+  int record_file;
+
+  static void WriteFully(int file_descriptor, const char* data, size_t length)
+  {
+    while (length > 0)
+    {
+      ssize_t written = write(file_descriptor, data, length);
+      if (written < 0 && errno == EINTR)
+      {
+        continue;
+      }
+      if (written <= 0)
+      {
+        return;
+      }
+      data += written;
+      length -= written;
+    }
+  }
+};
+
+/*! Parses hexadecimal number and advances 'string' */
+uintptr_t ParseHex(const char*& string)
+{
+  uintptr_t value = 0;
+  while (true)
+  {
+    char c = *string;
+    if (c >= '0' && c <= '9')
+    {
+      value = (value << 4) | (c - '0');
+    }
+    else if (c >= 'a' && c <= 'f')
+    {
+      value = (value << 4) | (c - 'a' + 10);
+    }
+    else
+    {
+      return value;
+    }
+    string++;
+  }
+}
+
+/*! Skips field separated by spaces and following spaces */
+void SkipField(const char*& string)
+{
+  while (*string && *string != ' ')
+  {
+    string++;
+  }
+  while (*string == ' ')
+  {
+    string++;
+  }
+}
+
+/*! Assigns module path and file offset to frames that are inside the mapping described by line of /proc/self/maps */
+void ProcessMapsLine(const char* line, size_t frame_count)
+{
+  // format: begin-end permissions offset device inode path
+  uintptr_t begin = ParseHex(line);
+  if (*line++ != '-')
+  {
+    return;
+  }
+  uintptr_t end = ParseHex(line);
+  SkipField(line);
+  SkipField(line);
+  uintptr_t offset = ParseHex(line);
+  SkipField(line);
+  SkipField(line);
+  SkipField(line);
+  if (*line != '/')
+  {
+    return;  // anonymous mapping or special mapping such as [vdso]
+  }
+
+  for (size_t i = 0; i < frame_count; i++)
+  {
+    uintptr_t address = reinterpret_cast<uintptr_t>(frames[i]);
+    if (address >= begin && address < end && !frame_paths[i][0])
+    {
+      frame_offsets[i] = address - begin + offset;
+      strncpy(frame_paths[i], line, cMAX_PATH_LENGTH - 1);
+      frame_paths[i][cMAX_PATH_LENGTH - 1] = 0;
+    }
+  }
+}
+
+/*! Finds modules of all frames via /proc/self/maps */
+void AssignModules(size_t frame_count)
+{
+  for (size_t i = 0; i < frame_count; i++)
+  {
+    frame_paths[i][0] = 0;
+  }
+  int maps = open("/proc/self/maps", O_RDONLY | O_CLOEXEC);
+  if (maps < 0)
+  {
+    return;
+  }
+  size_t line_length = 0;
+  bool line_too_long = false;
+  ssize_t bytes_read;
+  while ((bytes_read = read(maps, maps_buffer, sizeof(maps_buffer))) != 0)
+  {
+    if (bytes_read < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      break;
+    }
+    for (ssize_t i = 0; i < bytes_read; i++)
+    {
+      if (maps_buffer[i] == '\n')
+      {
+        maps_line[line_length] = 0;
+        if (!line_too_long)
+        {
+          ProcessMapsLine(maps_line, frame_count);
+        }
+        line_length = 0;
+        line_too_long = false;
+      }
+      else if (line_length < sizeof(maps_line) - 1)
+      {
+        maps_line[line_length++] = maps_buffer[i];
+      }
+      else
+      {
+        line_too_long = true;
+      }
+    }
+  }
+  close(maps);
+}
+
+/*! \return Address of instruction that caused signal (0 if unknown) */
+uintptr_t GetProgramCounter(void* context)
+{
+  const ucontext_t* user_context = static_cast<const ucontext_t*>(context);
+#if defined(__x86_64__)
+  return static_cast<uintptr_t>(user_context->uc_mcontext.gregs[REG_RIP]);
+#elif defined(__i386__)
+  return static_cast<uintptr_t>(user_context->uc_mcontext.gregs[REG_EIP]);
+#elif defined(__aarch64__)
+  return static_cast<uintptr_t>(user_context->uc_mcontext.pc);
+#else
+  (void)user_context;
+  return 0;
+#endif
+}
+
+void HandleSignal(int signal, siginfo_t* info, void* context)
+{
+  int saved_errno = errno;
+  long thread = syscall(SYS_gettid);
+  long expected = 0;
+  if (!handling_thread.compare_exchange_strong(expected, thread))
+  {
+    if (expected != thread)
+    {
+      // another thread is writing its record - process is terminated when it is done
+      while (true)
+      {
+        pause();
+      }
+    }
+    // crash in crash handler: fall through to previous handler
+  }
+  else
+  {
+    // stack trace (starting at the instruction that caused the signal)
+    uintptr_t program_counter = GetProgramCounter(context);
+    size_t frame_count = backtrace(frames + 1, tCrashHandler::cMAX_FRAMES);
+    size_t first = 1;
+    while (first <= frame_count && reinterpret_cast<uintptr_t>(frames[first]) != program_counter)
+    {
+      first++;
+    }
+    if (first > frame_count)
+    {
+      // program counter (0 if unknown) is always frame 0 - followed by the handler frames - so that all other frames are return addresses
+      first = 0;
+      frames[0] = reinterpret_cast<void*>(program_counter);
+      frame_count++;
+    }
+    else
+    {
+      frame_count -= first - 1;
+    }
+    frame_count = frame_count < tCrashHandler::cMAX_FRAMES ? frame_count : tCrashHandler::cMAX_FRAMES;
+    memmove(frames, frames + first, frame_count * sizeof(void*));
+    AssignModules(frame_count);
+
+    // record
+    int record_file = record_file_path[0] ? open(record_file_path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644) : -1;
+    tRecordWriter writer(record_file);
+    writer << "*** crash record ***\nsignal ";
+    writer.Decimal(signal) << " code ";
+    if (info->si_code < 0)
+    {
+      writer << "-";
+    }
+    writer.Decimal(info->si_code < 0 ? -info->si_code : info->si_code) << " address ";
+    writer.Hex(reinterpret_cast<uintptr_t>(info->si_addr), 2 * sizeof(void*)) << "\npid ";
+    writer.Decimal(getpid()) << " tid ";
+    writer.Decimal(thread) << "\n";
+    for (size_t i = 0; i < frame_count; i++)
+    {
+      writer << "frame ";
+      writer.Decimal(i) << " ";
+      writer.Hex(reinterpret_cast<uintptr_t>(frames[i]), 2 * sizeof(void*)) << " ";
+      if (frame_paths[i][0])
+      {
+        writer << frame_paths[i] << "+";
+        writer.Hex(frame_offsets[i], 1) << "\n";
+      }
+      else
+      {
+        writer << "??\n";
+      }
+    }
+    writer << "*** end of crash record ***\n";
+    if (record_file >= 0)
+    {
+      close(record_file);
+    }
+  }
+
+  // let previous handler (or default action) take over
+  for (size_t i = 0; i < cSIGNAL_COUNT; i++)
+  {
+    if (cSIGNALS[i] == signal)
+    {
+      sigaction(signal, &previous_actions[i], nullptr);
+    }
+  }
+  errno = saved_errno;
+  raise(signal);  // delivered when handler returns (signal is blocked until then)
+}
+
+/*! Alternate signal stack of thread (released when thread terminates) */
+struct tAlternateStack
+{
+  void* memory = nullptr;
+  size_t size = 0;
+
+  ~tAlternateStack()
+  {
+    if (memory)
+    {
+      stack_t stack;
+      memset(&stack, 0, sizeof(stack));
+      stack.ss_flags = SS_DISABLE;
+      sigaltstack(&stack, nullptr);
+      munmap(memory, size);
+    }
+  }
+};
+
+}
+#endif
+
+//----------------------------------------------------------------------
+// tCrashHandler Install
+//----------------------------------------------------------------------
+bool tCrashHandler::Install(const char* record_file)
+{
+#if __linux__
+  if (installed)
+  {
+    return true;
+  }
+  if (record_file && strlen(record_file) >= sizeof(record_file_path))
+  {
+    return false;
+  }
+  strcpy(record_file_path, record_file ? record_file : "");
+
+  // backtrace() loads libgcc on first use - this must not happen in signal handler
+  void* warm_up[1];
+  backtrace(warm_up, 1);
+
+  InstallAlternateStack();
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_sigaction = HandleSignal;
+  action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&action.sa_mask);
+  for (size_t i = 0; i < cSIGNAL_COUNT; i++)
+  {
+    if (sigaction(cSIGNALS[i], &action, &previous_actions[i]) != 0)
+    {
+      for (size_t j = 0; j < i; j++)
+      {
+        sigaction(cSIGNALS[j], &previous_actions[j], nullptr);
+      }
+      return false;
+    }
+  }
+  installed = true;
+  return true;
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------
+// tCrashHandler InstallAlternateStack
+//----------------------------------------------------------------------
+bool tCrashHandler::InstallAlternateStack()
+{
+#if __linux__
+  stack_t current;
+  if (sigaltstack(nullptr, &current) == 0 && !(current.ss_flags & SS_DISABLE))
+  {
+    return true;
+  }
+
+  thread_local tAlternateStack alternate_stack;
+  size_t size = 64 * 1024 + SIGSTKSZ;
+  void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED)
+  {
+    return false;
+  }
+  stack_t stack;
+  memset(&stack, 0, sizeof(stack));
+  stack.ss_sp = memory;
+  stack.ss_size = size;
+  if (sigaltstack(&stack, nullptr) != 0)
+  {
+    munmap(memory, size);
+    return false;
+  }
+  if (alternate_stack.memory)
+  {
+    munmap(alternate_stack.memory, alternate_stack.size);  // was disabled by someone else
+  }
+  alternate_stack.memory = memory;
+  alternate_stack.size = size;
+  return true;
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------
+// tCrashHandler SymbolizeRecord
+//----------------------------------------------------------------------
+std::string tCrashHandler::SymbolizeRecord(const std::string& record)
+{
+  std::istringstream input(record);
+  std::ostringstream output;
+  std::string line;
+  while (std::getline(input, line))
+  {
+    output << line;
+    size_t separator = line.rfind("+0x");
+    if (line.compare(0, 6, "frame ") == 0 && separator != std::string::npos)
+    {
+      // "frame <index> <address> <path>+<offset>"
+      std::istringstream frame(line.substr(6, separator - 6));
+      size_t index = 0;
+      std::string address;
+      frame >> index >> address >> std::ws;
+      std::string path;
+      std::getline(frame, path);
+      uintptr_t offset = 0;
+      try
+      {
+        offset = std::stoull(line.substr(separator + 3), nullptr, 16);
+      }
+      catch (const std::logic_error&)
+      {
+        // malformed (e.g. truncated) frame: copy unchanged
+        output << "\n";
+        continue;
+      }
+      if (index > 0)
+      {
+        offset--;  // return address: use call instruction
+      }
+      auto& symbolizer = tSymbolizer::Instance();
+      output << " in " << symbolizer.FormatLocation(path, symbolizer.GetModule(path)->FileOffsetToAddress(offset));
+    }
+    output << "\n";
+  }
+  return output.str();
+}
+
+//----------------------------------------------------------------------
+// tCrashHandler Uninstall
+//----------------------------------------------------------------------
+void tCrashHandler::Uninstall()
+{
+#if __linux__
+  if (installed)
+  {
+    for (size_t i = 0; i < cSIGNAL_COUNT; i++)
+    {
+      sigaction(cSIGNALS[i], &previous_actions[i], nullptr);
+    }
+    installed = false;
+  }
+#endif
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,147 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/exception/tCrashHandler.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tCrashHandler
+ *
+ * \b tCrashHandler
+ *
+ * Optional handler for fatal signals (SIGSEGV, SIGBUS, SIGFPE, SIGILL and
+ * SIGABRT) that writes a crash record with the raw stack trace - similar
+ * to the backtraces of uncaught traceable exceptions.
+ *
+ * The handler is async-signal-safe: it runs on an alternate signal stack
+ * (so stack overflows are handled as well), uses only preallocated memory
+ * and writes the record with write(). Every frame is recorded as absolute
+ * address and as file offset in the module it belongs to (from
+ * /proc/self/maps). Frame 0 is always the instruction that caused the
+ * signal (address 0 if it is unknown) - all other frames are return
+ * addresses.
+ * Symbolization happens offline - SymbolizeRecord() adds function names
+ * and source locations to a record (e.g. in a tool that processes records
+ * of crashed processes on the same machine).
+ *
+ * Example record:
+ *
+ *   *** crash record ***
+ *   signal 11 code 1 address 0x0000000000000000
+ *   pid 4242 tid 4242
+ *   frame 0 0x000055d0f6a3b169 /usr/bin/app+0x1169
+ *   frame 1 0x00007f8e1b42724a /usr/lib/x86_64-linux-gnu/libc.so.6+0x2724a
+ *   ...
+ *   *** end of crash record ***
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__exception__tCrashHandler_h__
+#define __rrlib__util__exception__tCrashHandler_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Writes crash records on fatal signals
+/*!
+ * After writing the record, the previously installed handler (or the
+ * default action, e.g. core dump) takes over.
+ *
+ * Alternate signal stacks are per thread: Install() sets one up for the
+ * calling thread. Other threads need to call InstallAlternateStack() to
+ * have their stack overflows recorded (other crashes in these threads are
+ * recorded in any case).
+ */
+class tCrashHandler
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Maximum number of frames in record */
+  static const size_t cMAX_FRAMES = 64;
+
+  /*!
+   * Installs crash handler for SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT
+   * (not async-signal-safe - call during initialization)
+   *
+   * \param record_file File that crash records are appended to (in addition to stderr - nullptr or empty for stderr only)
+   * \return False if handler could not be installed
+   */
+  static bool Install(const char* record_file = nullptr);
+
+  /*!
+   * Sets up alternate signal stack for the calling thread (no-op if there already is one)
+   *
+   * \return False if stack could not be set up
+   */
+  static bool InstallAlternateStack();
+
+  /*!
+   * Adds function names and source locations to the frames of crash records
+   * (all other lines are copied unchanged)
+   * Modules are read from the paths in the record - so this needs to run on
+   * a machine with the same binaries.
+   *
+   * \param record Text with one or more crash records
+   * \return Text with symbolized frames
+   */
+  static std::string SymbolizeRecord(const std::string& record);
+
+  /*!
+   * Removes crash handler (restores previous handlers)
+   */
+  static void Uninstall();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
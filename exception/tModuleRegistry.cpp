@@ -0,0 +1,197 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/exception/tModuleRegistry.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/exception/tModuleRegistry.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstddef>
+
+#if __linux__
+#include <link.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+#if __linux__
+namespace
+{
+
+/*! Loader's counters of loaded and unloaded objects */
+struct tLoaderCounters
+{
+  unsigned long long adds = 0, subs = 0;
+  bool available = false;
+};
+
+int ReadLoaderCounters(struct dl_phdr_info* info, size_t size, void* data)
+{
+  tLoaderCounters& counters = *static_cast<tLoaderCounters*>(data);
+  if (size >= offsetof(struct dl_phdr_info, dlpi_subs) + sizeof(info->dlpi_subs))
+  {
+    counters.adds = info->dlpi_adds;
+    counters.subs = info->dlpi_subs;
+    counters.available = true;
+  }
+  return 1;  // stop after first module
+}
+
+std::string LookupSelf()
+{
+  char self[1024];
+  ssize_t length = readlink("/proc/self/exe", self, sizeof(self) - 1);
+  return std::string(self, length > 0 ? length : 0);
+}
+
+
+}
+#endif
+
+//----------------------------------------------------------------------
+// tModuleTable Find
+//----------------------------------------------------------------------
+const tModule* tModuleTable::Find(const void* address) const
+{
+  uintptr_t value = reinterpret_cast<uintptr_t>(address);
+  auto segment = std::upper_bound(segments.begin(), segments.end(), value, [](uintptr_t value, const tSegment & segment)
+  {
+    return value < segment.begin;
+  });
+  if (segment == segments.begin())
+  {
+    return nullptr;
+  }
+  --segment;
+  return value < segment->end ? &modules[segment->module] : nullptr;
+}
+
+//----------------------------------------------------------------------
+// tModuleRegistry Instance
+//----------------------------------------------------------------------
+tModuleRegistry& tModuleRegistry::Instance()
+{
+  // never deleted: exceptions may be thrown during static destruction
+  static tModuleRegistry* instance = new tModuleRegistry();
+  return *instance;
+}
+
+//----------------------------------------------------------------------
+// tModuleRegistry GetModuleTable
+//----------------------------------------------------------------------
+std::shared_ptr<const tModuleTable> tModuleRegistry::GetModuleTable()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+#if __linux__
+  tLoaderCounters counters;
+  dl_iterate_phdr(ReadLoaderCounters, &counters);
+  if (table && counters.available && counters.adds == adds && counters.subs == subs)
+  {
+    return table;
+  }
+
+  struct tBuilder
+  {
+    std::shared_ptr<tModuleTable> table;
+    std::string self;
+
+    static int AddModule(struct dl_phdr_info* info, size_t, void* data)
+    {
+      tBuilder& builder = *static_cast<tBuilder*>(data);
+      tModuleTable& table = *builder.table;
+      size_t index = table.modules.size();
+      table.modules.push_back(tModule { (info->dlpi_name && info->dlpi_name[0]) ? info->dlpi_name : builder.self, info->dlpi_addr });
+      for (size_t i = 0; i < info->dlpi_phnum; i++)
+      {
+        const ElfW(Phdr)& segment = info->dlpi_phdr[i];
+        if (segment.p_type == PT_LOAD)
+        {
+          uintptr_t begin = info->dlpi_addr + segment.p_vaddr;
+          table.segments.push_back(tModuleTable::tSegment { begin, begin + segment.p_memsz, index });
+        }
+      }
+      return 0;
+    }
+  };
+
+  tBuilder builder { std::make_shared<tModuleTable>(), LookupSelf() };
+  dl_iterate_phdr(tBuilder::AddModule, &builder);
+  std::sort(builder.table->segments.begin(), builder.table->segments.end(), [](const tModuleTable::tSegment & a, const tModuleTable::tSegment & b)
+  {
+    return a.begin < b.begin;
+  });
+  table = builder.table;
+  adds = counters.adds;
+  subs = counters.subs;
+#else
+  if (!table)
+  {
+    table = std::make_shared<tModuleTable>();
+  }
+#endif
+  return table;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
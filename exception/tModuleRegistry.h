@@ -0,0 +1,181 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/exception/tModuleRegistry.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tModuleRegistry
+ *
+ * \b tModuleRegistry
+ *
+ * Process-wide table of the loaded ELF modules (executable and shared
+ * libraries) with their address ranges and load bias - for mapping code
+ * addresses to modules (e.g. for symbolization of backtraces).
+ *
+ * The table is obtained via dl_iterate_phdr and rebuilt only when shared
+ * objects have been loaded or unloaded since the last call (detected via
+ * the loader's dlpi_adds/dlpi_subs counters). Address lookup is a binary
+ * search.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__exception__tModuleRegistry_h__
+#define __rrlib__util__exception__tModuleRegistry_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Loaded ELF module */
+struct tModule
+{
+  /*! Path of module's file (as provided by the dynamic loader - for the executable, the path from /proc/self/exe) */
+  std::string path;
+
+  /*! Difference between addresses in this process and virtual addresses in the ELF file */
+  uintptr_t load_bias;
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Snapshot of loaded modules
+/*!
+ * Immutable - so it can be used without locking while modules are loaded
+ * or unloaded concurrently. Obtained from tModuleRegistry.
+ */
+class tModuleTable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param address Address in this process
+   * \return Module whose loadable segments contain address (nullptr if there is none)
+   */
+  const tModule* Find(const void* address) const;
+
+  /*!
+   * \return All modules (in the order of the dynamic loader - executable first)
+   */
+  const std::vector<tModule>& GetModules() const
+  {
+    return modules;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  friend class tModuleRegistry;
+
+  /*! Address range of loadable segment */
+  struct tSegment
+  {
+    uintptr_t begin, end;
+    size_t module;
+  };
+
+  /*! Modules */
+  std::vector<tModule> modules;
+
+  /*! Loadable segments of all modules sorted by address */
+  std::vector<tSegment> segments;
+};
+
+//! Registry of loaded modules
+/*!
+ * Provides an up-to-date tModuleTable.
+ * Thread-safe.
+ */
+class tModuleRegistry
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \return Process-wide instance
+   */
+  static tModuleRegistry& Instance();
+
+  /*!
+   * Checks whether shared objects were loaded or unloaded since the last call
+   * (cheap - the loader stops iterating after the first module)
+   * and rebuilds the table if this is the case.
+   *
+   * \return Current table of loaded modules
+   */
+  std::shared_ptr<const tModuleTable> GetModuleTable();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Current table */
+  std::shared_ptr<const tModuleTable> table;
+
+  /*! Loader's counters of loaded and unloaded objects when table was built */
+  unsigned long long adds = 0, subs = 0;
+
+  /*! Mutex for fields above */
+  std::mutex mutex;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,850 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/exception/tSymbolizer.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/exception/tSymbolizer.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#if __linux__
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/demangle.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+#if __linux__
+
+namespace
+{
+
+// DWARF constants used for line tables
+enum
+{
+  cDW_LNS_COPY = 1,
+  cDW_LNS_ADVANCE_PC,
+  cDW_LNS_ADVANCE_LINE,
+  cDW_LNS_SET_FILE,
+  cDW_LNS_SET_COLUMN,
+  cDW_LNS_NEGATE_STMT,
+  cDW_LNS_SET_BASIC_BLOCK,
+  cDW_LNS_CONST_ADD_PC,
+  cDW_LNS_FIXED_ADVANCE_PC,
+
+  cDW_LNE_END_SEQUENCE = 1,
+  cDW_LNE_SET_ADDRESS,
+  cDW_LNE_DEFINE_FILE,
+
+  cDW_LNCT_PATH = 1,
+  cDW_LNCT_DIRECTORY_INDEX,
+
+  cDW_FORM_BLOCK2 = 0x03,
+  cDW_FORM_BLOCK4 = 0x04,
+  cDW_FORM_DATA2 = 0x05,
+  cDW_FORM_DATA4 = 0x06,
+  cDW_FORM_DATA8 = 0x07,
+  cDW_FORM_STRING = 0x08,
+  cDW_FORM_BLOCK = 0x09,
+  cDW_FORM_BLOCK1 = 0x0a,
+  cDW_FORM_DATA1 = 0x0b,
+  cDW_FORM_STRP = 0x0e,
+  cDW_FORM_UDATA = 0x0f,
+  cDW_FORM_DATA16 = 0x1e,
+  cDW_FORM_LINE_STRP = 0x1f
+};
+
+/*!
+ * Bounds-checked reader for DWARF data
+ * (if data is exhausted, 'failed' is set and zeros are returned)
+ */
+struct tReader
+{
+  const char* position;
+  const char* end;
+  bool failed;
+
+  tReader(const char* begin, const char* end) : position(begin), end(end), failed(false)
+  {}
+
+  bool AtEnd() const
+  {
+    return failed || position >= end;
+  }
+
+  template <typename T>
+  T Read()
+  {
+    T value = 0;
+    if (static_cast<size_t>(end - position) < sizeof(T))
+    {
+      failed = true;
+      position = end;
+      return 0;
+    }
+    memcpy(&value, position, sizeof(T));
+    position += sizeof(T);
+    return value;
+  }
+
+  uint64_t ReadAddress(size_t size)
+  {
+    switch (size)
+    {
+    case 4:
+      return Read<uint32_t>();
+    case 8:
+      return Read<uint64_t>();
+    default:
+      Skip(size);
+      return 0;
+    }
+  }
+
+  uint64_t ReadOffset(bool dwarf64)
+  {
+    return dwarf64 ? Read<uint64_t>() : Read<uint32_t>();
+  }
+
+  uint64_t ReadULEB128()
+  {
+    uint64_t result = 0;
+    unsigned int shift = 0;
+    while (position < end)
+    {
+      uint8_t byte = static_cast<uint8_t>(*position++);
+      if (shift < 64)
+      {
+        result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      }
+      shift += 7;
+      if ((byte & 0x80) == 0)
+      {
+        return result;
+      }
+    }
+    failed = true;
+    return 0;
+  }
+
+  int64_t ReadSLEB128()
+  {
+    int64_t result = 0;
+    unsigned int shift = 0;
+    while (position < end)
+    {
+      uint8_t byte = static_cast<uint8_t>(*position++);
+      if (shift < 64)
+      {
+        result |= static_cast<int64_t>(byte & 0x7f) << shift;
+      }
+      shift += 7;
+      if ((byte & 0x80) == 0)
+      {
+        if (shift < 64 && (byte & 0x40))
+        {
+          result |= -(static_cast<int64_t>(1) << shift);
+        }
+        return result;
+      }
+    }
+    failed = true;
+    return 0;
+  }
+
+  const char* ReadString()
+  {
+    const char* string = position;
+    const char* terminator = static_cast<const char*>(memchr(position, 0, end - position));
+    if (!terminator)
+    {
+      failed = true;
+      position = end;
+      return "";
+    }
+    position = terminator + 1;
+    return string;
+  }
+
+  void Skip(size_t bytes)
+  {
+    if (static_cast<size_t>(end - position) < bytes)
+    {
+      failed = true;
+      position = end;
+      return;
+    }
+    position += bytes;
+  }
+};
+
+/*! String from string section (empty string if offset is invalid) */
+const char* SectionString(const char* section, size_t section_size, uint64_t offset)
+{
+  if (!section || offset >= section_size || !memchr(section + offset, 0, section_size - offset))
+  {
+    return "";
+  }
+  return section + offset;
+}
+
+/*! Entry format of DWARF 5 directory and file name tables */
+typedef std::vector<std::pair<uint64_t, uint64_t>> tEntryFormat;
+
+/*!
+ * Reads DWARF 5 directory or file name table
+ *
+ * \return Vector with path and directory index of every entry
+ */
+std::vector<std::pair<std::string, uint64_t>> ReadEntryTable(tReader& reader, bool dwarf64, const char* debug_line_str, size_t debug_line_str_size, const char* debug_str, size_t debug_str_size)
+{
+  tEntryFormat format;
+  uint8_t format_count = reader.Read<uint8_t>();
+  for (uint8_t i = 0; i < format_count; i++)
+  {
+    uint64_t content_type = reader.ReadULEB128();
+    format.emplace_back(content_type, reader.ReadULEB128());
+  }
+
+  std::vector<std::pair<std::string, uint64_t>> entries;
+  uint64_t count = reader.ReadULEB128();
+  for (uint64_t i = 0; i < count && !reader.AtEnd(); i++)
+  {
+    std::pair<std::string, uint64_t> entry("", 0);
+    for (auto & field : format)
+    {
+      const char* string = nullptr;
+      uint64_t value = 0;
+      switch (field.second)
+      {
+      case cDW_FORM_STRING:
+        string = reader.ReadString();
+        break;
+      case cDW_FORM_LINE_STRP:
+        string = SectionString(debug_line_str, debug_line_str_size, reader.ReadOffset(dwarf64));
+        break;
+      case cDW_FORM_STRP:
+        string = SectionString(debug_str, debug_str_size, reader.ReadOffset(dwarf64));
+        break;
+      case cDW_FORM_UDATA:
+        value = reader.ReadULEB128();
+        break;
+      case cDW_FORM_DATA1:
+        value = reader.Read<uint8_t>();
+        break;
+      case cDW_FORM_DATA2:
+        value = reader.Read<uint16_t>();
+        break;
+      case cDW_FORM_DATA4:
+        value = reader.Read<uint32_t>();
+        break;
+      case cDW_FORM_DATA8:
+        value = reader.Read<uint64_t>();
+        break;
+      case cDW_FORM_DATA16:
+        reader.Skip(16);
+        break;
+      case cDW_FORM_BLOCK:
+        reader.Skip(reader.ReadULEB128());
+        break;
+      case cDW_FORM_BLOCK1:
+        reader.Skip(reader.Read<uint8_t>());
+        break;
+      case cDW_FORM_BLOCK2:
+        reader.Skip(reader.Read<uint16_t>());
+        break;
+      case cDW_FORM_BLOCK4:
+        reader.Skip(reader.Read<uint32_t>());
+        break;
+      default:
+        reader.failed = true;  // unknown form: size of field is unknown
+        return entries;
+      }
+      if (field.first == cDW_LNCT_PATH && string)
+      {
+        entry.first = string;
+      }
+      else if (field.first == cDW_LNCT_DIRECTORY_INDEX)
+      {
+        entry.second = value;
+      }
+    }
+    entries.push_back(std::move(entry));
+  }
+  return entries;
+}
+
+/*! \return Path of file in directory */
+std::string JoinPath(const std::string& directory, const std::string& file)
+{
+  if (directory.empty() || file.empty() || file[0] == '/')
+  {
+    return file;
+  }
+  return directory + (directory.back() == '/' ? "" : "/") + file;
+}
+
+}
+
+//----------------------------------------------------------------------
+// tElfModule constructors
+//----------------------------------------------------------------------
+tElfModule::tElfModule(const std::string& path) :
+  path(path),
+  data(nullptr),
+  size(0)
+{
+  int file_descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (file_descriptor < 0)
+  {
+    return;
+  }
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) == 0 && file_status.st_size > static_cast<off_t>(sizeof(ElfW(Ehdr))))
+  {
+    void* mapping = mmap(nullptr, file_status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (mapping != MAP_FAILED)
+    {
+      data = static_cast<const char*>(mapping);
+      size = file_status.st_size;
+    }
+  }
+  close(file_descriptor);
+
+  if (data)
+  {
+    try
+    {
+      Load();
+    }
+    catch (const std::bad_alloc&)
+    {
+      symbols.clear();
+      lines.clear();
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tElfModule destructor
+//----------------------------------------------------------------------
+tElfModule::~tElfModule()
+{
+  if (data)
+  {
+    munmap(const_cast<char*>(data), size);
+  }
+}
+
+//----------------------------------------------------------------------
+// tElfModule Load
+//----------------------------------------------------------------------
+void tElfModule::Load()
+{
+  const ElfW(Ehdr)* header = reinterpret_cast<const ElfW(Ehdr)*>(data);
+  if (memcmp(header->e_ident, ELFMAG, SELFMAG) != 0 || header->e_ident[EI_CLASS] != (sizeof(void*) == 8 ? ELFCLASS64 : ELFCLASS32) ||
+      header->e_shentsize != sizeof(ElfW(Shdr)) || header->e_shoff + header->e_shnum * sizeof(ElfW(Shdr)) > size ||
+      header->e_phoff + header->e_phnum * sizeof(ElfW(Phdr)) > size || header->e_shstrndx >= header->e_shnum)
+  {
+    return;
+  }
+
+  // loadable segments
+  const ElfW(Phdr)* program_headers = reinterpret_cast<const ElfW(Phdr)*>(data + header->e_phoff);
+  for (size_t i = 0; i < header->e_phnum; i++)
+  {
+    if (program_headers[i].p_type == PT_LOAD)
+    {
+      segments.push_back(tSegment { program_headers[i].p_offset, program_headers[i].p_vaddr, program_headers[i].p_filesz });
+    }
+  }
+
+  // find sections
+  const ElfW(Shdr)* sections = reinterpret_cast<const ElfW(Shdr)*>(data + header->e_shoff);
+  auto section_data = [&](const ElfW(Shdr)& section) -> const char*
+  {
+    if (section.sh_type == SHT_NOBITS || (section.sh_flags & SHF_COMPRESSED) || section.sh_offset + section.sh_size > size)
+    {
+      return nullptr;
+    }
+    return data + section.sh_offset;
+  };
+  const ElfW(Shdr)& section_names = sections[header->e_shstrndx];
+  const char* section_name_data = section_data(section_names);
+  const ElfW(Shdr)* symtab = nullptr, *dynsym = nullptr, *debug_line = nullptr, *debug_line_str = nullptr, *debug_str = nullptr;
+  for (size_t i = 0; i < header->e_shnum; i++)
+  {
+    const char* name = SectionString(section_name_data, section_names.sh_size, sections[i].sh_name);
+    if (sections[i].sh_type == SHT_SYMTAB)
+    {
+      symtab = &sections[i];
+    }
+    else if (sections[i].sh_type == SHT_DYNSYM)
+    {
+      dynsym = &sections[i];
+    }
+    else if (strcmp(name, ".debug_line") == 0)
+    {
+      debug_line = &sections[i];
+    }
+    else if (strcmp(name, ".debug_line_str") == 0)
+    {
+      debug_line_str = &sections[i];
+    }
+    else if (strcmp(name, ".debug_str") == 0)
+    {
+      debug_str = &sections[i];
+    }
+  }
+
+  // symbols
+  const ElfW(Shdr)* symbol_table = symtab ? symtab : dynsym;
+  if (symbol_table && symbol_table->sh_link < header->e_shnum && section_data(*symbol_table) && section_data(sections[symbol_table->sh_link]))
+  {
+    ReadSymbols(section_data(*symbol_table), symbol_table->sh_size, section_data(sections[symbol_table->sh_link]), sections[symbol_table->sh_link].sh_size);
+  }
+
+  // line tables
+  if (debug_line && section_data(*debug_line))
+  {
+    ReadLineTables(section_data(*debug_line), debug_line->sh_size,
+                   debug_line_str ? section_data(*debug_line_str) : nullptr, debug_line_str ? debug_line_str->sh_size : 0,
+                   debug_str ? section_data(*debug_str) : nullptr, debug_str ? debug_str->sh_size : 0);
+  }
+}
+
+//----------------------------------------------------------------------
+// tElfModule FileOffsetToAddress
+//----------------------------------------------------------------------
+uintptr_t tElfModule::FileOffsetToAddress(uintptr_t file_offset) const
+{
+  for (auto & segment : segments)
+  {
+    if (file_offset >= segment.file_offset && file_offset < segment.file_offset + segment.size)
+    {
+      return file_offset - segment.file_offset + segment.address;
+    }
+  }
+  return file_offset;
+}
+
+//----------------------------------------------------------------------
+// tElfModule Lookup
+//----------------------------------------------------------------------
+bool tElfModule::Lookup(uintptr_t address, tSymbolInfo& info) const
+{
+  info.function = nullptr;
+  info.file = nullptr;
+  info.line = 0;
+
+  auto symbol = std::upper_bound(symbols.begin(), symbols.end(), address, [](uintptr_t address, const tSymbol & symbol)
+  {
+    return address < symbol.address;
+  });
+  if (symbol != symbols.begin())
+  {
+    --symbol;
+    if (symbol->size == 0 || address < symbol->address + symbol->size)
+    {
+      info.function = symbol->name;
+    }
+  }
+
+  auto line = std::upper_bound(lines.begin(), lines.end(), address, [](uintptr_t address, const tLine & line)
+  {
+    return address < line.address;
+  });
+  if (line != lines.begin())
+  {
+    --line;
+    if (!line->end_sequence)
+    {
+      info.file = files[line->file].c_str();
+      info.line = line->line;
+    }
+  }
+
+  return info.function != nullptr || info.line != 0;
+}
+
+//----------------------------------------------------------------------
+// tElfModule ReadLineTables
+//----------------------------------------------------------------------
+void tElfModule::ReadLineTables(const char* debug_line, size_t debug_line_size, const char* debug_line_str, size_t debug_line_str_size, const char* debug_str, size_t debug_str_size)
+{
+  std::unordered_map<std::string, uint32_t> file_indices;
+  auto file_index = [&](const std::string & file)
+  {
+    auto it = file_indices.find(file);
+    if (it != file_indices.end())
+    {
+      return it->second;
+    }
+    uint32_t index = static_cast<uint32_t>(files.size());
+    files.push_back(file);
+    file_indices.emplace(file, index);
+    return index;
+  };
+
+  tReader unit_reader(debug_line, debug_line + debug_line_size);
+  while (!unit_reader.AtEnd())
+  {
+    // unit header
+    uint64_t unit_length = unit_reader.Read<uint32_t>();
+    bool dwarf64 = unit_length == 0xffffffff;
+    if (dwarf64)
+    {
+      unit_length = unit_reader.Read<uint64_t>();
+    }
+    if (unit_reader.failed || unit_length > static_cast<uint64_t>(unit_reader.end - unit_reader.position))
+    {
+      return;
+    }
+    const char* unit_end = unit_reader.position + unit_length;
+    tReader reader(unit_reader.position, unit_end);
+    unit_reader.position = unit_end;
+
+    uint16_t version = reader.Read<uint16_t>();
+    if (version < 2 || version > 5)
+    {
+      continue;
+    }
+    if (version >= 5)
+    {
+      reader.Read<uint8_t>();  // address size (DW_LNE_set_address carries its own length)
+      reader.Read<uint8_t>();  // segment selector size
+    }
+    uint64_t header_length = reader.ReadOffset(dwarf64);
+    if (header_length > static_cast<uint64_t>(reader.end - reader.position))
+    {
+      continue;
+    }
+    const char* program = reader.position + header_length;
+    uint8_t minimum_instruction_length = reader.Read<uint8_t>();
+    if (version >= 4)
+    {
+      reader.Read<uint8_t>();  // maximum operations per instruction (VLIW only)
+    }
+    bool default_is_stmt = reader.Read<uint8_t>() != 0;
+    int8_t line_base = reader.Read<int8_t>();
+    uint8_t line_range = reader.Read<uint8_t>();
+    uint8_t opcode_base = reader.Read<uint8_t>();
+    std::vector<uint8_t> standard_opcode_lengths(opcode_base > 0 ? opcode_base - 1 : 0);
+    for (auto & length : standard_opcode_lengths)
+    {
+      length = reader.Read<uint8_t>();
+    }
+    if (reader.failed || line_range == 0)
+    {
+      continue;
+    }
+
+    // directories and files (indices into 'files' of this module)
+    std::vector<std::string> directories;
+    std::vector<uint32_t> unit_files;
+    if (version >= 5)
+    {
+      for (auto & directory : ReadEntryTable(reader, dwarf64, debug_line_str, debug_line_str_size, debug_str, debug_str_size))
+      {
+        directories.push_back(directory.first);
+      }
+      for (auto & file : ReadEntryTable(reader, dwarf64, debug_line_str, debug_line_str_size, debug_str, debug_str_size))
+      {
+        unit_files.push_back(file_index(JoinPath(file.second < directories.size() ? directories[file.second] : "", file.first)));
+      }
+    }
+    else
+    {
+      directories.emplace_back();  // directory 0 is the compilation directory (not stored in line table)
+      while (!reader.AtEnd())
+      {
+        const char* directory = reader.ReadString();
+        if (!*directory)
+        {
+          break;
+        }
+        directories.emplace_back(directory);
+      }
+      unit_files.push_back(file_index(""));  // file indices start at 1
+      while (!reader.AtEnd())
+      {
+        const char* file = reader.ReadString();
+        if (!*file)
+        {
+          break;
+        }
+        uint64_t directory = reader.ReadULEB128();
+        reader.ReadULEB128();  // modification time
+        reader.ReadULEB128();  // file size
+        unit_files.push_back(file_index(JoinPath(directory < directories.size() ? directories[directory] : "", file)));
+      }
+    }
+    if (reader.failed || unit_files.empty())
+    {
+      continue;
+    }
+
+    // line number program
+    reader.position = program;
+    uintptr_t address = 0;
+    uint64_t file = version >= 5 ? 0 : 1;
+    int64_t line = 1;
+    bool is_stmt = default_is_stmt;
+    auto add_row = [&](bool end_sequence)
+    {
+      tLine row;
+      row.address = address;
+      row.file = unit_files[file < unit_files.size() ? file : 0];
+      row.line = static_cast<uint32_t>(line > 0 ? line : 0) & 0x7fffffff;
+      row.end_sequence = end_sequence ? 1 : 0;
+      lines.push_back(row);
+    };
+    while (!reader.AtEnd())
+    {
+      uint8_t opcode = reader.Read<uint8_t>();
+      if (opcode >= opcode_base)
+      {
+        uint8_t adjusted_opcode = opcode - opcode_base;
+        address += (adjusted_opcode / line_range) * minimum_instruction_length;
+        line += line_base + adjusted_opcode % line_range;
+        add_row(false);
+        continue;
+      }
+      switch (opcode)
+      {
+      case 0:  // extended opcode
+      {
+        uint64_t length = reader.ReadULEB128();
+        if (length == 0 || length > static_cast<uint64_t>(reader.end - reader.position))
+        {
+          reader.failed = true;
+          break;
+        }
+        const char* next = reader.position + length;
+        uint8_t extended_opcode = reader.Read<uint8_t>();
+        if (extended_opcode == cDW_LNE_END_SEQUENCE)
+        {
+          add_row(true);
+          address = 0;
+          file = version >= 5 ? 0 : 1;
+          line = 1;
+          is_stmt = default_is_stmt;
+        }
+        else if (extended_opcode == cDW_LNE_SET_ADDRESS)
+        {
+          address = static_cast<uintptr_t>(reader.ReadAddress(length - 1));
+        }
+        else if (extended_opcode == cDW_LNE_DEFINE_FILE)
+        {
+          const char* name = reader.ReadString();
+          uint64_t directory = reader.ReadULEB128();
+          unit_files.push_back(file_index(JoinPath(directory < directories.size() ? directories[directory] : "", name)));
+        }
+        reader.position = next;
+        break;
+      }
+      case cDW_LNS_COPY:
+        add_row(false);
+        break;
+      case cDW_LNS_ADVANCE_PC:
+        address += reader.ReadULEB128() * minimum_instruction_length;
+        break;
+      case cDW_LNS_ADVANCE_LINE:
+        line += reader.ReadSLEB128();
+        break;
+      case cDW_LNS_SET_FILE:
+        file = reader.ReadULEB128();
+        break;
+      case cDW_LNS_NEGATE_STMT:
+        is_stmt = !is_stmt;
+        break;
+      case cDW_LNS_CONST_ADD_PC:
+        address += ((255 - opcode_base) / line_range) * minimum_instruction_length;
+        break;
+      case cDW_LNS_FIXED_ADVANCE_PC:
+        address += reader.Read<uint16_t>();
+        break;
+      default:
+        // other standard opcodes (e.g. set column) only have ULEB128 operands that are not needed
+        for (uint8_t i = 0; i < standard_opcode_lengths[opcode - 1]; i++)
+        {
+          reader.ReadULEB128();
+        }
+        break;
+      }
+    }
+  }
+
+  // sort by address (sequence ends first - so that a sequence starting at the same address is found)
+  std::stable_sort(lines.begin(), lines.end(), [](const tLine & a, const tLine & b)
+  {
+    return a.address < b.address || (a.address == b.address && a.end_sequence > b.end_sequence);
+  });
+  lines.shrink_to_fit();
+}
+
+//----------------------------------------------------------------------
+// tElfModule ReadSymbols
+//----------------------------------------------------------------------
+void tElfModule::ReadSymbols(const char* symbol_table, size_t symbol_table_size, const char* string_table, size_t string_table_size)
+{
+  const ElfW(Sym)* elf_symbols = reinterpret_cast<const ElfW(Sym)*>(symbol_table);
+  size_t count = symbol_table_size / sizeof(ElfW(Sym));
+  for (size_t i = 0; i < count; i++)
+  {
+    const ElfW(Sym)& symbol = elf_symbols[i];
+    unsigned int type = ELF64_ST_TYPE(symbol.st_info);
+    if ((type == STT_FUNC || type == STT_GNU_IFUNC) && symbol.st_shndx != SHN_UNDEF && symbol.st_value != 0 && symbol.st_name < string_table_size)
+    {
+      symbols.push_back(tSymbol { symbol.st_value, symbol.st_size, SectionString(string_table, string_table_size, symbol.st_name) });
+    }
+  }
+  std::sort(symbols.begin(), symbols.end(), [](const tSymbol & a, const tSymbol & b)
+  {
+    return a.address < b.address || (a.address == b.address && a.size > b.size);
+  });
+  symbols.shrink_to_fit();
+}
+
+#else
+
+tElfModule::tElfModule(const std::string& path) :
+  path(path),
+  data(nullptr),
+  size(0)
+{}
+
+tElfModule::~tElfModule()
+{}
+
+uintptr_t tElfModule::FileOffsetToAddress(uintptr_t file_offset) const
+{
+  return file_offset;
+}
+
+bool tElfModule::Lookup(uintptr_t address, tSymbolInfo& info) const
+{
+  info.function = nullptr;
+  info.file = nullptr;
+  info.line = 0;
+  return false;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// tSymbolizer Instance
+//----------------------------------------------------------------------
+tSymbolizer& tSymbolizer::Instance()
+{
+  // never deleted: exceptions may be thrown during static destruction
+  static tSymbolizer* instance = new tSymbolizer();
+  return *instance;
+}
+
+//----------------------------------------------------------------------
+// tSymbolizer GetModule
+//----------------------------------------------------------------------
+std::shared_ptr<const tElfModule> tSymbolizer::GetModule(const std::string& path)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = modules.find(path);
+  if (it == modules.end())
+  {
+    it = modules.emplace(path, std::make_shared<tElfModule>(path)).first;
+  }
+  return it->second;
+}
+
+//----------------------------------------------------------------------
+// tSymbolizer FormatLocation
+//----------------------------------------------------------------------
+std::string tSymbolizer::FormatLocation(const std::string& path, uintptr_t address)
+{
+  tSymbolInfo info;
+  if (!GetModule(path)->Lookup(address, info))
+  {
+    return "?? from " + path;
+  }
+
+  std::string location(info.function ? DemangleCached(info.function) : std::string_view("??"));  // function names point into module - which is never unloaded
+  if (info.file && info.file[0] && info.line)
+  {
+    location += " at " + std::string(info.file) + ":" + std::to_string(info.line);
+  }
+  else
+  {
+    location += " from " + path;
+  }
+  return location;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
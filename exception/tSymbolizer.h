@@ -0,0 +1,255 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/exception/tSymbolizer.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tSymbolizer
+ *
+ * \b tSymbolizer
+ *
+ * Resolves code addresses to function names, source files and line
+ * numbers - in-process, by reading the ELF symbol tables and the DWARF
+ * line number information (.debug_line) of the binaries.
+ *
+ * Every binary (executable or shared library) is loaded once - on first
+ * use - and kept in a cache that is shared by all threads. Afterwards, a
+ * lookup is two binary searches.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__exception__tSymbolizer_h__
+#define __rrlib__util__exception__tSymbolizer_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Result of symbol lookup */
+struct tSymbolInfo
+{
+  /*! Mangled name of function (nullptr if unknown - points into cached binary) */
+  const char* function;
+
+  /*! Source file (nullptr if unknown) */
+  const char* file;
+
+  /*! Line in source file (0 if unknown) */
+  unsigned int line;
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Symbol and line information of one ELF binary
+/*!
+ * Reads function symbols (.symtab or .dynsym) and DWARF line tables
+ * (versions 2 to 5) of an ELF binary.
+ * The file is mapped into memory for the lifetime of this object.
+ *
+ * Compressed debug sections and separate debug info files are not
+ * supported (only function names are available then).
+ */
+class tElfModule
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param path Path of ELF file
+   */
+  explicit tElfModule(const std::string& path);
+
+  ~tElfModule();
+
+  tElfModule(const tElfModule&) = delete;
+  tElfModule& operator=(const tElfModule&) = delete;
+
+  /*!
+   * \param file_offset Offset in ELF file (e.g. from a crash record)
+   * \return Virtual address in ELF file that this file offset is loaded to (file_offset if it is not in a loadable segment)
+   */
+  uintptr_t FileOffsetToAddress(uintptr_t file_offset) const;
+
+  /*!
+   * \return Path of ELF file
+   */
+  const std::string& GetPath() const
+  {
+    return path;
+  }
+
+  /*!
+   * \return Whether file could be read
+   */
+  bool IsValid() const
+  {
+    return data != nullptr;
+  }
+
+  /*!
+   * Looks up function and source location of an address
+   *
+   * \param address Virtual address in ELF file (address in process minus load bias - see tModuleRegistry)
+   * \param info Contains result after call (members are null/zero if nothing was found)
+   * \return True if the function or the source location was found
+   */
+  bool Lookup(uintptr_t address, tSymbolInfo& info) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Function symbol */
+  struct tSymbol
+  {
+    uintptr_t address, size;
+    const char* name;
+  };
+
+  /*! Loadable segment */
+  struct tSegment
+  {
+    uintptr_t file_offset, address, size;
+  };
+
+  /*! Row of line number table */
+  struct tLine
+  {
+    uintptr_t address;
+    uint32_t file;
+    uint32_t line : 31;
+    uint32_t end_sequence : 1;
+  };
+
+  /*! Path of ELF file */
+  std::string path;
+
+  /*! Mapped ELF file (nullptr if file could not be read) */
+  const char* data;
+  size_t size;
+
+  /*! Loadable segments */
+  std::vector<tSegment> segments;
+
+  /*! Function symbols sorted by address */
+  std::vector<tSymbol> symbols;
+
+  /*! Line number tables of all compilation units sorted by address */
+  std::vector<tLine> lines;
+
+  /*! Source files referenced by lines */
+  std::vector<std::string> files;
+
+
+  /*! Reads ELF headers, symbols and line tables */
+  void Load();
+
+  /*! Reads symbol table */
+  void ReadSymbols(const char* symbol_table, size_t symbol_table_size, const char* string_table, size_t string_table_size);
+
+  /*! Reads .debug_line section */
+  void ReadLineTables(const char* debug_line, size_t debug_line_size, const char* debug_line_str, size_t debug_line_str_size, const char* debug_str, size_t debug_str_size);
+};
+
+//! Cache of ELF modules
+/*!
+ * Provides tElfModule objects - loading every file only once.
+ * Thread-safe.
+ */
+class tSymbolizer
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \return Process-wide instance
+   */
+  static tSymbolizer& Instance();
+
+  /*!
+   * \param path Path of ELF file
+   * \return Module (loaded on first call for every path - may be invalid if file cannot be read)
+   */
+  std::shared_ptr<const tElfModule> GetModule(const std::string& path);
+
+  /*!
+   * Describes location of an address in the style of addr2line
+   * ("function at file:line", "function from module" or "?? from module")
+   *
+   * \param path Path of ELF file
+   * \param address Virtual address in ELF file
+   * \return Description of location
+   */
+  std::string FormatLocation(const std::string& path, uintptr_t address);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Loaded modules */
+  std::map<std::string, std::shared_ptr<const tElfModule>> modules;
+
+  /*! Mutex for modules */
+  std::mutex mutex;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,285 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/exception/tTraceReporter.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/exception/tTraceReporter.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tTraceReporter::cQUEUE_CAPACITY;
+const size_t tTraceReporter::cMAX_MESSAGE_LENGTH;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+namespace
+{
+
+void PrintReport(const tTraceReport& report)
+{
+  std::cerr << "=== Traceable exception";
+  if (report.count > 1)
+  {
+    std::cerr << " (" << report.count << " occurrences)";
+  }
+  if (!report.message.empty())
+  {
+    std::cerr << ": " << report.message;
+  }
+  std::cerr << " ===\nBacktrace:\n" << report.backtrace << std::endl;
+}
+
+/*! \return Whether count is a power of ten */
+bool IsPowerOfTen(uint64_t count)
+{
+  while (count >= 10 && count % 10 == 0)
+  {
+    count /= 10;
+  }
+  return count == 1;
+}
+
+}
+
+//----------------------------------------------------------------------
+// tTraceReporter constructors
+//----------------------------------------------------------------------
+tTraceReporter::tTraceReporter() :
+  slots(new tSlot[cQUEUE_CAPACITY]),
+  enqueue_position(0),
+  dropped(0),
+  dequeue_position(0),
+  processed(0),
+  output(PrintReport)
+{
+  static_assert((cQUEUE_CAPACITY & (cQUEUE_CAPACITY - 1)) == 0, "Queue capacity must be a power of two");
+  for (size_t i = 0; i < cQUEUE_CAPACITY; i++)
+  {
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  sem_init(&ready, 0, 0);
+  std::thread(&tTraceReporter::Run, this).detach();
+}
+
+//----------------------------------------------------------------------
+// tTraceReporter Instance
+//----------------------------------------------------------------------
+tTraceReporter& tTraceReporter::Instance()
+{
+  // never deleted: background thread runs until process terminates
+  static tTraceReporter* instance = new tTraceReporter();
+  return *instance;
+}
+
+//----------------------------------------------------------------------
+// tTraceReporter Enqueue
+//----------------------------------------------------------------------
+bool tTraceReporter::Enqueue(const tTraceableExceptionBase& exception, const char* message) noexcept
+{
+  size_t depth = exception.GetStackTraceDepth();
+  if (depth == 0)
+  {
+    return false;
+  }
+
+  size_t position = enqueue_position.load(std::memory_order_relaxed);
+  tSlot* slot;
+  while (true)
+  {
+    slot = &slots[position & (cQUEUE_CAPACITY - 1)];
+    intptr_t difference = static_cast<intptr_t>(slot->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position);
+    if (difference == 0)
+    {
+      if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (difference < 0)
+    {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else
+    {
+      position = enqueue_position.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->depth = depth;
+  memcpy(slot->stack_trace, exception.GetStackTrace(), depth * sizeof(void*));
+  strncpy(slot->message, message ? message : "", cMAX_MESSAGE_LENGTH - 1);
+  slot->message[cMAX_MESSAGE_LENGTH - 1] = 0;
+  slot->sequence.store(position + 1, std::memory_order_release);
+  sem_post(&ready);
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tTraceReporter Flush
+//----------------------------------------------------------------------
+void tTraceReporter::Flush()
+{
+  uint64_t enqueued = enqueue_position.load(std::memory_order_acquire);
+  std::unique_lock<std::mutex> lock(mutex);
+  processed_changed.wait(lock, [&]()
+  {
+    return processed >= enqueued;
+  });
+}
+
+//----------------------------------------------------------------------
+// tTraceReporter GetReports
+//----------------------------------------------------------------------
+std::vector<tTraceReport> tTraceReporter::GetReports()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  std::vector<tTraceReport> result;
+  result.reserve(reports.size());
+  for (auto & entry : reports)
+  {
+    result.push_back(entry.second);
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------
+// tTraceReporter Run
+//----------------------------------------------------------------------
+void tTraceReporter::Run()
+{
+  std::vector<void*> trace;
+  while (true)
+  {
+    while (sem_wait(&ready) != 0 && errno == EINTR)
+    {}
+
+    // slot at dequeue_position may still be written by a producer that was overtaken by the one that signalled
+    tSlot& slot = slots[dequeue_position & (cQUEUE_CAPACITY - 1)];
+    while (slot.sequence.load(std::memory_order_acquire) != dequeue_position + 1)
+    {
+      std::this_thread::yield();
+    }
+    trace.assign(slot.stack_trace, slot.stack_trace + slot.depth);
+    std::string message(slot.message);
+    slot.sequence.store(dequeue_position + cQUEUE_CAPACITY, std::memory_order_release);
+    dequeue_position++;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = reports.find(trace);
+    if (it == reports.end())
+    {
+      lock.unlock();
+      std::string backtrace;
+      try
+      {
+        backtrace = tTraceableExceptionBase::FormatBacktrace(trace.data(), trace.size());  // without lock: takes time
+      }
+      catch (const std::exception& exception)
+      {
+        backtrace = std::string("<Backtrace could not be symbolized: ") + exception.what() + ">";
+      }
+      lock.lock();
+      it = reports.emplace(trace, tTraceReport { message, backtrace, 0 }).first;
+    }
+    it->second.count++;
+    if (IsPowerOfTen(it->second.count) && output)
+    {
+      tTraceReport report = it->second;
+      auto output_copy = output;
+      lock.unlock();
+      output_copy(report);
+      lock.lock();
+    }
+    processed++;
+    lock.unlock();
+    processed_changed.notify_all();
+  }
+}
+
+//----------------------------------------------------------------------
+// tTraceReporter SetOutput
+//----------------------------------------------------------------------
+void tTraceReporter::SetOutput(const std::function<void(const tTraceReport&)>& output)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  this->output = output;
+}
+
+//----------------------------------------------------------------------
+// tTraceReporter tTraceHash
+//----------------------------------------------------------------------
+size_t tTraceReporter::tTraceHash::operator()(const std::vector<void*>& trace) const
+{
+  uint64_t hash = 14695981039346656037ull;
+  for (void* address : trace)
+  {
+    hash = (hash ^ reinterpret_cast<uintptr_t>(address)) * 1099511628211ull;
+  }
+  return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
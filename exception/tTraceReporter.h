@@ -0,0 +1,235 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/exception/tTraceReporter.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tTraceReporter
+ *
+ * \b tTraceReporter
+ *
+ * Reports stack traces of traceable exceptions from a background thread.
+ *
+ * Symbolizing a backtrace (Backtrace()) takes time - which is a problem
+ * on the error paths of real-time threads. With tTraceReporter, the
+ * throwing (or catching) thread only copies the raw return addresses
+ * into a preallocated, lock-free queue. A background thread symbolizes
+ * them.
+ *
+ * Traces are deduplicated by their raw frame addresses: every distinct
+ * trace is symbolized once and reported with its number of occurrences -
+ * so an exception thrown in a loop does not flood the output.
+ *
+ *   catch (const tTraceableException<std::runtime_error> &exception)
+ *   {
+ *     tTraceReporter::Instance().Enqueue(exception);
+ *     ...
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__exception__tTraceReporter_h__
+#define __rrlib__util__exception__tTraceReporter_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <semaphore.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tTraceableException.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Deduplicated trace */
+struct tTraceReport
+{
+  /*! Message of first exception with this trace */
+  std::string message;
+
+  /*! Symbolized backtrace */
+  std::string backtrace;
+
+  /*! Number of times this trace was enqueued */
+  uint64_t count;
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Background symbolization and deduplicated reporting of stack traces
+/*!
+ * Enqueue() is lock-free and does not allocate memory. If the queue is
+ * full, the trace is dropped (and counted - see GetDroppedCount()).
+ *
+ * The output function is called from the background thread - for the
+ * first occurrence of a trace and whenever its count reaches a power of
+ * ten. By default, reports are printed to std::cerr.
+ *
+ * The background thread is started when Instance() is called first.
+ * Applications with real-time threads should call it during
+ * initialization.
+ */
+class tTraceReporter
+{
+  /*! Capacity of the queue (power of two) */
+  static const size_t cQUEUE_CAPACITY = 256;
+
+  /*! Maximum length of message stored with a trace in queue */
+  static const size_t cMAX_MESSAGE_LENGTH = 128;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \return Process-wide instance
+   */
+  static tTraceReporter& Instance();
+
+  /*!
+   * Enqueues stack trace of an exception for reporting
+   * (nothing is enqueued if exception has no stack trace)
+   *
+   * \param exception Exception whose stack trace is reported
+   * \param message Message to report with trace (truncated to cMAX_MESSAGE_LENGTH - 1 characters)
+   * \return True if trace was enqueued (false if queue is full or exception has no stack trace)
+   */
+  bool Enqueue(const tTraceableExceptionBase& exception, const char* message = "") noexcept;
+
+  template <typename T>
+  bool Enqueue(const tTraceableException<T>& exception) noexcept
+  {
+    return Enqueue(static_cast<const tTraceableExceptionBase&>(exception), exception.what());
+  }
+
+  /*!
+   * Blocks until all traces enqueued before this call have been processed
+   */
+  void Flush();
+
+  /*!
+   * \return Number of traces dropped because queue was full
+   */
+  uint64_t GetDroppedCount() const
+  {
+    return dropped.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \return All distinct traces reported so far (with current counts)
+   */
+  std::vector<tTraceReport> GetReports();
+
+  /*!
+   * \param output Function called by background thread with reports (replaces default output to std::cerr)
+   */
+  void SetOutput(const std::function<void(const tTraceReport&)>& output);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Queue entry (sequence numbers as in Dmitry Vyukov's bounded MPMC queue) */
+  struct tSlot
+  {
+    std::atomic<size_t> sequence;
+    size_t depth;
+    void* stack_trace[cMAX_STACK_TRACE_DEPTH];
+    char message[cMAX_MESSAGE_LENGTH];
+  };
+
+  /*! Hash function for raw traces */
+  struct tTraceHash
+  {
+    size_t operator()(const std::vector<void*>& trace) const;
+  };
+
+  /*! Queue */
+  std::unique_ptr<tSlot[]> slots;
+
+  /*! Next position to enqueue to */
+  alignas(64) std::atomic<size_t> enqueue_position;
+
+  /*! Number of dropped traces */
+  std::atomic<uint64_t> dropped;
+
+  /*! Next position to dequeue from (background thread only) */
+  alignas(64) size_t dequeue_position;
+
+  /*! Number of traces processed by background thread */
+  uint64_t processed;
+
+  /*! Distinct traces */
+  std::unordered_map<std::vector<void*>, tTraceReport, tTraceHash> reports;
+
+  /*! Output function */
+  std::function<void(const tTraceReport&)> output;
+
+  /*! Number of traces in queue that are ready to be processed */
+  sem_t ready;
+
+  /*! Mutex for processed, reports and output */
+  std::mutex mutex;
+
+  /*! Signalled when traces have been processed */
+  std::condition_variable processed_changed;
+
+
+  tTraceReporter();
+
+  /*! Main loop of background thread */
+  void Run();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
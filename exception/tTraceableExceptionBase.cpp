@@ -33,6 +33,7 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <stdexcept>
+#include <atomic>
 #include <iostream>
 #include <sstream>
 #include <cstring>
@@ -40,12 +41,14 @@
 
 #if __linux__
 #include <execinfo.h>
-#include <unistd.h>
+#include <pthread.h>
 #endif
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/util/exception/tModuleRegistry.h"
+#include "rrlib/util/exception/tSymbolizer.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -67,13 +70,6 @@ namespace util
 //----------------------------------------------------------------------
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
-struct tMapEntry
-{
-  void *begin;
-  void *end;
-  std::string filename;
-};
-
 //----------------------------------------------------------------------
 // Const values
 //----------------------------------------------------------------------
@@ -89,129 +85,14 @@ const size_t cCALLS_TO_SKIP = 2;
 #ifndef RRLIB_UTIL_EXCEPTION_DISABLE_TRACING
 namespace
 {
-std::string LookupSelf()
-{
-  char self[1024];
-  std::stringstream link;
-  link << "/proc/" << getpid() << "/exe";
-  ssize_t length = readlink(link.str().c_str(), self, sizeof(self));
-  if (static_cast<size_t>(length) < sizeof(self))
-  {
-    self[length] = 0;
-  }
-  return self;
-}
-
-std::vector<tMapEntry> ReadMaps() noexcept
-{
-  std::vector<tMapEntry> map_entries;
-
-  try
-  {
-    std::stringstream proc_maps;
-    proc_maps << "/proc/" << getpid() << "/maps";
-    FILE *maps = fopen(proc_maps.str().c_str(), "r");
-    if (maps)
-    {
-      char buffer[1024];
-      while (!feof(maps))
-      {
-        if (fgets(buffer, sizeof(buffer), maps) != NULL)
-        {
-          std::stringstream input(buffer);
-          char begin[64];
-          std::string size;
-          input >> begin >> size >> size >> size >> size;
-          if (size != "0")
-          {
-            char *end = begin;
-            for (; *end != '-'; ++end);
-            *end++ = 0;
-            map_entries.push_back({reinterpret_cast<void *>(strtoll(begin, nullptr, 16)), reinterpret_cast<void *>(strtoll(end, nullptr, 16)), ""});
-            std::ws(input);
-            std::getline(input, map_entries.back().filename);
-          }
-        }
-      }
-      fclose(maps);
-      auto keep = map_entries.begin();
-      for (auto read = keep; read != map_entries.end(); ++read)
-      {
-        if (read != keep)
-        {
-          if (read->begin == keep->end && read->filename == keep->filename)
-          {
-            keep->end = read->end;
-          }
-          else
-          {
-            *(++keep) = *read;
-          }
-        }
-      }
-      map_entries.erase(++keep, map_entries.end());
-    }
-  }
-  catch (std::bad_alloc &error)
-  {
-    std::cerr << "Error during address mapping: " << error.what() << std::endl;
-    map_entries.clear();
-  }
-
-  return map_entries;
-}
-
-std::string LookupLocation(void *address, const std::vector<tMapEntry> &map_entries, const std::string &self)
+std::string LookupLocation(void *address, const tModuleTable &modules)
 {
   try
   {
-    for (auto it = map_entries.begin(); it != map_entries.end(); ++it)
+    const tModule *module = modules.Find(address);
+    if (module)
     {
-      if (it->begin <= address && address <= it->end)
-      {
-        std::string location;
-
-        if (it->filename != self)
-        {
-          address = reinterpret_cast<void *>(reinterpret_cast<char *>(address) - reinterpret_cast<char *>(it->begin));
-        }
-        address = reinterpret_cast<void *>(reinterpret_cast<char *>(address) - 1);
-
-        std::stringstream run_addr2line;
-        std::string filename = it->filename;
-        size_t position = 0;
-        while ((position = filename.find_first_of("\\\"", position)) != filename.npos)
-        {
-          filename.insert(position, "\\");
-          position += 2;
-        }
-        run_addr2line << "addr2line -fpCe \"" << filename << "\" " << address << " 2> /dev/null";
-        FILE *pipe = popen(run_addr2line.str().c_str(), "r");
-        if (pipe)
-        {
-          while (!feof(pipe))
-          {
-            char buffer[128];
-            if (fgets(buffer, sizeof(buffer), pipe) != NULL)
-            {
-              location += buffer;
-            }
-          }
-        }
-        pclose(pipe);
-        location.erase(location.find_last_not_of("\n\r\t ") + 1);
-
-        if (!location.empty())
-        {
-          auto unknown = location.find("at ??");
-          if (unknown != location.npos)
-          {
-            location.erase(unknown);
-            location += "from " + it->filename;
-          }
-          return location;
-        }
-      }
+      return tSymbolizer::Instance().FormatLocation(module->path, reinterpret_cast<uintptr_t>(address) - module->load_bias - 1);
     }
   }
   catch (std::bad_alloc &error)
@@ -245,26 +126,120 @@ void terminate() noexcept
   abort();
 }
 
+std::atomic<tBacktraceMode> backtrace_mode(tBacktraceMode::UNWIND);
+std::atomic<unsigned int> backtrace_sampling(1);
+thread_local unsigned int exceptions_since_sample = 0;
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+#define RRLIB_UTIL_EXCEPTION_FRAME_POINTERS
+
+/*! Stack of current thread */
+struct tStackBounds
+{
+  uintptr_t begin = 0, end = 0;
+
+  tStackBounds()
+  {
+    pthread_attr_t attributes;
+    if (pthread_getattr_np(pthread_self(), &attributes) == 0)
+    {
+      void *address;
+      size_t size;
+      if (pthread_attr_getstack(&attributes, &address, &size) == 0)
+      {
+        begin = reinterpret_cast<uintptr_t>(address);
+        end = begin + size;
+      }
+      pthread_attr_destroy(&attributes);
+    }
+  }
+};
+
+/*!
+ * Walks the frame pointer chain
+ * (no unwind tables and no locks involved - stops at the first frame record that is not on this thread's stack)
+ *
+ * \return Number of return addresses written to buffer (first one is in the caller of this function - as with backtrace())
+ */
+__attribute__((noinline)) size_t CaptureFramePointers(void **buffer, size_t size) noexcept
+{
+  thread_local tStackBounds stack_bounds;
+  const uintptr_t *frame = static_cast<const uintptr_t *>(__builtin_frame_address(0));
+  size_t depth = 0;
+  while (depth < size)
+  {
+    uintptr_t address = reinterpret_cast<uintptr_t>(frame);
+    if (address < stack_bounds.begin || address + 2 * sizeof(uintptr_t) > stack_bounds.end || (address & (sizeof(uintptr_t) - 1)) || frame[1] == 0)
+    {
+      break;
+    }
+    buffer[depth++] = reinterpret_cast<void *>(frame[1]);
+    const uintptr_t *next_frame = reinterpret_cast<const uintptr_t *>(frame[0]);
+    if (next_frame <= frame)
+    {
+      break;
+    }
+    frame = next_frame;
+  }
+  return depth;
+}
+#endif
+
 }
 
 #endif
 
-//----------------------------------------------------------------------
-// tTraceableExceptionBase constructors
-//----------------------------------------------------------------------
-tTraceableExceptionBase::tTraceableExceptionBase() :
+namespace
+{
+/*!
+ * Captures stack trace if tracing is enabled and exception is sampled
+ * (inlined in constructors - so that the first frame is the constructor as with plain backtrace())
+ */
+__attribute__((always_inline)) inline size_t CaptureStackTrace(void **buffer, bool capture) noexcept
+{
 #if defined(NDEBUG) || defined(RRLIB_UTIL_EXCEPTION_DISABLE_TRACING)
-  stack_trace_depth(0)
-{}
+  (void)buffer;
+  (void)capture;
+  return 0;
 #else
-  stack_trace_depth(backtrace(this->stack_trace, cMAX_STACK_TRACE_DEPTH))
-{
-  if (!original_terminate)
+  static const bool terminate_handler_installed = (original_terminate = std::set_terminate(terminate), true);
+  (void)terminate_handler_installed;
+
+  unsigned int interval = backtrace_sampling.load(std::memory_order_relaxed);
+  if (!capture || interval == 0)
   {
-    original_terminate = std::set_terminate(terminate);
+    return 0;
+  }
+  if (interval > 1)
+  {
+    if (++exceptions_since_sample < interval)
+    {
+      return 0;
+    }
+    exceptions_since_sample = 0;
+  }
+
+#ifdef RRLIB_UTIL_EXCEPTION_FRAME_POINTERS
+  if (backtrace_mode.load(std::memory_order_relaxed) == tBacktraceMode::FRAME_POINTERS)
+  {
+    return CaptureFramePointers(buffer, cMAX_STACK_TRACE_DEPTH);
   }
-}
 #endif
+  return backtrace(buffer, cMAX_STACK_TRACE_DEPTH);
+#endif
+}
+}
+
+//----------------------------------------------------------------------
+// tTraceableExceptionBase constructors
+//----------------------------------------------------------------------
+tTraceableExceptionBase::tTraceableExceptionBase() :
+  stack_trace_depth(CaptureStackTrace(this->stack_trace, true))
+{}
+
+tTraceableExceptionBase::tTraceableExceptionBase(bool capture) :
+  stack_trace_depth(CaptureStackTrace(this->stack_trace, capture))
+{}
 
 //----------------------------------------------------------------------
 // tTraceableExceptionBase destructor
@@ -279,7 +254,11 @@ const char *tTraceableExceptionBase::Backtrace() const noexcept
 {
   if (this->stack_trace_depth == 0)
   {
+#if defined(NDEBUG) || defined(RRLIB_UTIL_EXCEPTION_DISABLE_TRACING)
     return "<Backtrace was optimized out>";
+#else
+    return "<Backtrace was not captured>";
+#endif
   }
 
 #ifndef RRLIB_UTIL_EXCEPTION_DISABLE_TRACING
@@ -287,26 +266,7 @@ const char *tTraceableExceptionBase::Backtrace() const noexcept
   {
     try
     {
-      std::stringstream backtrace;
-
-      std::string self = LookupSelf();
-      std::vector<tMapEntry> map_entries = ReadMaps();
-
-      char address_example[64];
-      snprintf(address_example, sizeof(address_example), "%p", reinterpret_cast<void *>(-1));
-      char format_string[8];
-      snprintf(format_string, sizeof(format_string), "0x%%0%zux", strlen(address_example) - 2);
-
-      for (size_t i = cCALLS_TO_SKIP; i < this->stack_trace_depth; ++i)
-      {
-        char formatted_address[sizeof(address_example)];
-        snprintf(formatted_address, sizeof(formatted_address), format_string, this->stack_trace[i]);
-        backtrace << "#" << (i - cCALLS_TO_SKIP) << "  " << formatted_address;
-        backtrace << " in " << LookupLocation(this->stack_trace[i], map_entries, self);
-        backtrace << "\n";
-      }
-
-      this->buffered_backtrace = backtrace.str();
+      this->buffered_backtrace = FormatBacktrace(this->stack_trace, this->stack_trace_depth);
     }
     catch (std::bad_alloc &error)
     {
@@ -321,6 +281,56 @@ const char *tTraceableExceptionBase::Backtrace() const noexcept
 #endif
 }
 
+//----------------------------------------------------------------------
+// tTraceableExceptionBase FormatBacktrace
+//----------------------------------------------------------------------
+std::string tTraceableExceptionBase::FormatBacktrace(void *const *stack_trace, size_t stack_trace_depth)
+{
+#ifndef RRLIB_UTIL_EXCEPTION_DISABLE_TRACING
+  std::stringstream backtrace;
+
+  auto modules = tModuleRegistry::Instance().GetModuleTable();
+
+  char address_example[64];
+  snprintf(address_example, sizeof(address_example), "%p", reinterpret_cast<void *>(-1));
+  char format_string[8];
+  snprintf(format_string, sizeof(format_string), "0x%%0%zux", strlen(address_example) - 2);
+
+  for (size_t i = cCALLS_TO_SKIP; i < stack_trace_depth; ++i)
+  {
+    char formatted_address[sizeof(address_example)];
+    snprintf(formatted_address, sizeof(formatted_address), format_string, stack_trace[i]);
+    backtrace << "#" << (i - cCALLS_TO_SKIP) << "  " << formatted_address;
+    backtrace << " in " << LookupLocation(stack_trace[i], *modules);
+    backtrace << "\n";
+  }
+
+  return backtrace.str();
+#else
+  return "<No backtrace available>";
+#endif
+}
+
+//----------------------------------------------------------------------
+// tTraceableExceptionBase SetBacktraceMode
+//----------------------------------------------------------------------
+void tTraceableExceptionBase::SetBacktraceMode(tBacktraceMode mode)
+{
+#ifndef RRLIB_UTIL_EXCEPTION_DISABLE_TRACING
+  backtrace_mode.store(mode, std::memory_order_relaxed);
+#endif
+}
+
+//----------------------------------------------------------------------
+// tTraceableExceptionBase SetBacktraceSampling
+//----------------------------------------------------------------------
+void tTraceableExceptionBase::SetBacktraceSampling(unsigned int interval)
+{
+#ifndef RRLIB_UTIL_EXCEPTION_DISABLE_TRACING
+  backtrace_sampling.store(interval, std::memory_order_relaxed);
+#endif
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -41,6 +41,8 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <cstddef>
+#include <string>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -59,6 +61,13 @@ namespace util
 //----------------------------------------------------------------------
 const size_t cMAX_STACK_TRACE_DEPTH = 20;
 
+/*! How stack traces of exceptions are captured */
+enum class tBacktraceMode
+{
+  UNWIND,         //!< glibc backtrace() - uses DWARF unwind information (complete, but expensive)
+  FRAME_POINTERS  //!< walks the frame pointer chain (cheap - complete only if code is compiled with -fno-omit-frame-pointer)
+};
+
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
@@ -82,6 +91,56 @@ public:
 
   const char *Backtrace() const noexcept;
 
+  /*!
+   * \return Raw return addresses of the stack trace (including the frames of the exception constructors)
+   */
+  void *const *GetStackTrace() const
+  {
+    return this->stack_trace;
+  }
+
+  /*!
+   * \return Number of entries in GetStackTrace() (0 if no stack trace was captured)
+   */
+  size_t GetStackTraceDepth() const
+  {
+    return this->stack_trace_depth;
+  }
+
+  /*!
+   * Symbolizes and formats a raw stack trace as Backtrace() does
+   * (e.g. for traces that were copied from an exception)
+   *
+   * \param stack_trace Raw return addresses as provided by GetStackTrace()
+   * \param stack_trace_depth Number of return addresses
+   * \return Formatted backtrace (one line per frame)
+   */
+  static std::string FormatBacktrace(void *const *stack_trace, size_t stack_trace_depth);
+
+  /*!
+   * Sets how stack traces are captured (process-wide; default is UNWIND)
+   * FRAME_POINTERS falls back to UNWIND on platforms without a known frame layout.
+   */
+  static void SetBacktraceMode(tBacktraceMode mode);
+
+  /*!
+   * Captures stack traces only for every n-th traceable exception thrown by a thread
+   * (process-wide; default is 1)
+   *
+   * \param interval Sampling interval (0 disables capturing)
+   */
+  static void SetBacktraceSampling(unsigned int interval);
+
+//----------------------------------------------------------------------
+// Protected methods
+//----------------------------------------------------------------------
+protected:
+
+  /*!
+   * \param capture Whether to capture a stack trace (subject to sampling)
+   */
+  explicit tTraceableExceptionBase(bool capture);
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -114,6 +114,28 @@ namespace util
 template <typename charT, typename traits>
 int GetFileDescriptor(const std::basic_streambuf<charT, traits> *stream_buffer);
 
+//! GetFileDescriptor with a per-thread cache keyed on the stream buffer
+/*! GetFileDescriptor needs up to three dynamic_casts. This variant
+ *  remembers the results of recent lookups in a small per-thread table, so
+ *  repeated lookups for the same stream buffer (e.g. the one of std::cerr
+ *  for every log message) cost a single comparison.
+ *
+ *  The cache cannot notice that a stream buffer was destroyed (and another
+ *  one created at the same address) or that a file stream was reopened.
+ *  InvalidateFileDescriptorCache() must be called in these cases. Code
+ *  that keeps a reference to the stream anyway is better off resolving the
+ *  descriptor once with tFileDescriptorHandle.
+ *
+ * \param stream_buffer   The stream buffer of which the file descriptor should be determined
+ *
+ * \returns  The integer file descriptor associated with the streambuf, or -1 (see GetFileDescriptor)
+ */
+template <typename charT, typename traits>
+int GetCachedFileDescriptor(const std::basic_streambuf<charT, traits> *stream_buffer);
+
+//! Invalidates the cached results of GetCachedFileDescriptor in all threads
+inline void InvalidateFileDescriptorCache();
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
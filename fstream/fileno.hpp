@@ -34,6 +34,8 @@
 #include <cstdio>
 #include <fstream>
 #include <cerrno>
+#include <atomic>
+#include <cstdint>
 
 #if defined(__GLIBCXX__) || (defined(__GLIBCPP__) && __GLIBCPP__>=20020514)  // GCC >= 3.1.0
 # include <ext/stdio_filebuf.h>
@@ -45,6 +47,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/util/fstream/tFileDescriptorStreamBuffer.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -207,20 +210,68 @@ inline int fileno_hack(std::basic_streambuf<charT, traits> *stream_buffer)
 
 //! 8-Bit character instantiation: GetFileDescriptor(ios).
 template <>
-int GetFileDescriptor<char>(const std::streambuf *stream_buffer)
+inline int GetFileDescriptor<char>(const std::streambuf *stream_buffer)
 {
+  const tFileDescriptorStreamBuffer *fd_buffer = dynamic_cast<const tFileDescriptorStreamBuffer *>(stream_buffer);
+  if (fd_buffer != NULL)
+  {
+    return fd_buffer->FileDescriptor();
+  }
   return fileno_hack(const_cast<std::streambuf *>(stream_buffer));
 }
 
 #if !(defined(__GLIBCXX__) || defined(__GLIBCPP__)) || (defined(_GLIBCPP_USE_WCHAR_T) || defined(_GLIBCXX_USE_WCHAR_T))
 //! Wide character instantiation: GetFileDescriptor(wios).
 template <>
-int GetFileDescriptor<wchar_t>(const std::wstreambuf *stream_buffer)
+inline int GetFileDescriptor<wchar_t>(const std::wstreambuf *stream_buffer)
 {
   return fileno_hack(const_cast<std::wstreambuf *>(stream_buffer));
 }
 #endif
 
+namespace internal
+{
+
+/*! Number of entries in per-thread cache of GetCachedFileDescriptor (power of two) */
+const size_t cFILE_DESCRIPTOR_CACHE_SIZE = 8;
+
+/*! Entry in per-thread cache of GetCachedFileDescriptor */
+struct tFileDescriptorCacheEntry
+{
+  const void *stream_buffer;
+  unsigned int generation;
+  int file_descriptor;
+};
+
+/*! Incremented by InvalidateFileDescriptorCache - entries from older generations are ignored */
+inline std::atomic<unsigned int> file_descriptor_cache_generation(1);
+
+}
+
+template <typename charT, typename traits>
+inline int GetCachedFileDescriptor(const std::basic_streambuf<charT, traits> *stream_buffer)
+{
+  static thread_local internal::tFileDescriptorCacheEntry cache[internal::cFILE_DESCRIPTOR_CACHE_SIZE];
+  unsigned int generation = internal::file_descriptor_cache_generation.load(std::memory_order_relaxed);
+  internal::tFileDescriptorCacheEntry &entry = cache[(reinterpret_cast<uintptr_t>(stream_buffer) >> 4) & (internal::cFILE_DESCRIPTOR_CACHE_SIZE - 1)];
+  if (entry.stream_buffer == stream_buffer && entry.generation == generation)
+  {
+    if (entry.file_descriptor < 0)
+    {
+      errno = EBADF;
+    }
+    return entry.file_descriptor;
+  }
+  int file_descriptor = GetFileDescriptor(stream_buffer);
+  entry = internal::tFileDescriptorCacheEntry { stream_buffer, generation, file_descriptor };
+  return file_descriptor;
+}
+
+inline void InvalidateFileDescriptorCache()
+{
+  internal::file_descriptor_cache_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
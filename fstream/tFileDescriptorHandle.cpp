@@ -0,0 +1,123 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/fstream/tFileDescriptorHandle.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/fstream/tFileDescriptorHandle.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+extern "C"
+{
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tFileDescriptorHandle constructors
+//----------------------------------------------------------------------
+tFileDescriptorHandle::tFileDescriptorHandle(int file_descriptor) :
+  tFileDescriptorHandle()
+{
+  struct stat status;
+  if (file_descriptor < 0 || fstat(file_descriptor, &status) != 0)
+  {
+    return;
+  }
+  this->file_descriptor = file_descriptor;
+  switch (status.st_mode & S_IFMT)
+  {
+  case S_IFREG:
+    type = tFileType::REGULAR;
+    break;
+  case S_IFDIR:
+    type = tFileType::DIRECTORY;
+    break;
+  case S_IFCHR:
+    type = tFileType::CHARACTER_DEVICE;
+    is_terminal = isatty(file_descriptor);
+    break;
+  case S_IFBLK:
+    type = tFileType::BLOCK_DEVICE;
+    break;
+  case S_IFIFO:
+    type = tFileType::PIPE;
+#ifdef F_GETPIPE_SZ
+    {
+      int capacity = fcntl(file_descriptor, F_GETPIPE_SZ);
+      pipe_capacity = capacity > 0 ? capacity : 0;
+    }
+#endif
+    break;
+  case S_IFSOCK:
+    type = tFileType::SOCKET;
+    break;
+  default:
+    break;
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
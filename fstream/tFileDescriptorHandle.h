@@ -0,0 +1,197 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/fstream/tFileDescriptorHandle.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tFileDescriptorHandle
+ *
+ * \b tFileDescriptorHandle
+ *
+ * Properties of a file descriptor that are determined once, on construction.
+ *
+ * Code that writes to a stream frequently (e.g. logging sinks) often
+ * needs to know whether the stream is a terminal (colors, line buffering),
+ * a pipe or a regular file. Determining this per message requires
+ * GetFileDescriptor and system calls. Instead, a tFileDescriptorHandle
+ * is created when the stream is attached - afterwards every query is a
+ * single load.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__fstream__tFileDescriptorHandle_h__
+#define __rrlib__util__fstream__tFileDescriptorHandle_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <streambuf>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/fstream/fileno.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Type of file a file descriptor refers to (see fstat) */
+enum class tFileType
+{
+  UNKNOWN,           //!< Invalid handle or unknown file type
+  REGULAR,           //!< Regular file
+  DIRECTORY,         //!< Directory
+  CHARACTER_DEVICE,  //!< Character device (e.g. a terminal or /dev/null)
+  BLOCK_DEVICE,      //!< Block device
+  PIPE,              //!< Pipe or FIFO
+  SOCKET             //!< Socket
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Cached properties of a file descriptor
+/*!
+ * Resolves a file descriptor - possibly from a stream buffer via
+ * GetFileDescriptor - and queries its properties once on construction.
+ * The handle does not own the file descriptor.
+ *
+ * Properties are not updated if the descriptor is closed or reused
+ * afterwards - so the handle should be created again whenever the
+ * stream it was created from is reopened.
+ *
+ * Usage:
+ *
+ *   tFileDescriptorHandle handle(std::cerr.rdbuf());
+ *   ...
+ *   if (handle.IsTerminal())
+ *   {
+ *     ...
+ *   }
+ */
+class tFileDescriptorHandle
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Creates invalid handle */
+  tFileDescriptorHandle() :
+    file_descriptor(-1),
+    type(tFileType::UNKNOWN),
+    is_terminal(false),
+    pipe_capacity(0)
+  {}
+
+  /*!
+   * \param file_descriptor File descriptor to query properties of
+   */
+  explicit tFileDescriptorHandle(int file_descriptor);
+
+  /*!
+   * \param stream_buffer Stream buffer whose file descriptor to query properties of (handle is invalid if it has none)
+   */
+  template <typename charT, typename traits>
+  explicit tFileDescriptorHandle(const std::basic_streambuf<charT, traits> *stream_buffer) :
+    tFileDescriptorHandle(stream_buffer ? GetFileDescriptor(stream_buffer) : -1)
+  {}
+
+  /*!
+   * \return File descriptor (-1 if handle is invalid)
+   */
+  int FileDescriptor() const
+  {
+    return file_descriptor;
+  }
+
+  /*!
+   * \return Capacity of pipe in bytes (0 if file descriptor does not refer to a pipe or capacity cannot be determined)
+   */
+  size_t PipeCapacity() const
+  {
+    return pipe_capacity;
+  }
+
+  /*!
+   * \return Whether file descriptor refers to a terminal (see isatty)
+   */
+  bool IsTerminal() const
+  {
+    return is_terminal;
+  }
+
+  /*!
+   * \return Whether handle refers to a valid file descriptor
+   */
+  bool IsValid() const
+  {
+    return file_descriptor >= 0;
+  }
+
+  /*!
+   * \return Type of file that file descriptor refers to
+   */
+  tFileType Type() const
+  {
+    return type;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! File descriptor (-1 if handle is invalid) */
+  int file_descriptor;
+
+  /*! Type of file that file descriptor refers to */
+  tFileType type;
+
+  /*! Whether file descriptor refers to a terminal */
+  bool is_terminal;
+
+  /*! Capacity of pipe in bytes (0 if not a pipe) */
+  size_t pipe_capacity;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,467 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/fstream/tFileDescriptorStreamBuffer.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/fstream/tFileDescriptorStreamBuffer.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+
+extern "C"
+{
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+}
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tFileDescriptorStreamBuffer::cDEFAULT_BUFFER_SIZE;
+
+/*! Maximum number of bytes to transfer with a single splice or sendfile call */
+const size_t cMAX_KERNEL_COPY_CHUNK = 1 << 30;
+
+/*! Size of the buffer used by CopyStreamBuffer if data cannot be copied inside the kernel */
+const size_t cCOPY_BUFFER_SIZE = 64 * 1024;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+int OpenFlags(std::ios_base::openmode mode)
+{
+  int flags = O_CLOEXEC;
+  if ((mode & std::ios_base::in) && (mode & (std::ios_base::out | std::ios_base::app)))
+  {
+    flags |= O_RDWR | O_CREAT;
+  }
+  else if (mode & std::ios_base::in)
+  {
+    flags |= O_RDONLY;
+  }
+  else
+  {
+    flags |= O_WRONLY | O_CREAT;
+    if (!(mode & std::ios_base::app))
+    {
+      flags |= O_TRUNC;
+    }
+  }
+  if (mode & std::ios_base::app)
+  {
+    flags |= O_APPEND;
+  }
+  if (mode & std::ios_base::trunc)
+  {
+    flags |= O_TRUNC;
+  }
+  return flags;
+}
+
+bool IsPipe(int file_descriptor)
+{
+  struct stat status;
+  return fstat(file_descriptor, &status) == 0 && S_ISFIFO(status.st_mode);
+}
+
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer constructors
+//----------------------------------------------------------------------
+tFileDescriptorStreamBuffer::tFileDescriptorStreamBuffer(int file_descriptor, std::ios_base::openmode mode, size_t buffer_size) :
+  file_descriptor(file_descriptor),
+  close_file_descriptor(false),
+  buffer_size(std::max<size_t>(buffer_size, 16))
+{
+  if (mode & std::ios_base::in)
+  {
+    read_buffer.reset(new char[this->buffer_size]);
+    setg(read_buffer.get(), read_buffer.get(), read_buffer.get());
+  }
+  if (mode & (std::ios_base::out | std::ios_base::app))
+  {
+    write_buffer.reset(new char[this->buffer_size]);
+    setp(write_buffer.get(), write_buffer.get() + this->buffer_size);
+  }
+}
+
+tFileDescriptorStreamBuffer::tFileDescriptorStreamBuffer(const std::string& file_name, std::ios_base::openmode mode, size_t buffer_size) :
+  tFileDescriptorStreamBuffer(open(file_name.c_str(), OpenFlags(mode), 0666), mode, buffer_size)
+{
+  if (file_descriptor < 0)
+  {
+    throw std::runtime_error("Could not open file <" + file_name + ">: " + strerror(errno));
+  }
+  close_file_descriptor = true;
+  if (!(mode & (std::ios_base::out | std::ios_base::app)))
+  {
+    Advise(POSIX_FADV_SEQUENTIAL);
+  }
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer destructor
+//----------------------------------------------------------------------
+tFileDescriptorStreamBuffer::~tFileDescriptorStreamBuffer()
+{
+  FlushWriteBuffer();
+  if (close_file_descriptor)
+  {
+    close(file_descriptor);
+  }
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer Advise
+//----------------------------------------------------------------------
+bool tFileDescriptorStreamBuffer::Advise(int advice, off_t offset, off_t length)
+{
+  return posix_fadvise(file_descriptor, offset, length, advice) == 0;
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer DiscardReadAhead
+//----------------------------------------------------------------------
+void tFileDescriptorStreamBuffer::DiscardReadAhead()
+{
+  if (gptr() != egptr())
+  {
+    lseek(file_descriptor, gptr() - egptr(), SEEK_CUR);  // fails on pipes and sockets, where there is nothing to correct
+    setg(eback(), egptr(), egptr());
+  }
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer overflow
+//----------------------------------------------------------------------
+tFileDescriptorStreamBuffer::int_type tFileDescriptorStreamBuffer::overflow(int_type c)
+{
+  if (!write_buffer)
+  {
+    return traits_type::eof();
+  }
+  if (traits_type::eq_int_type(c, traits_type::eof()))
+  {
+    return FlushWriteBuffer() ? traits_type::not_eof(c) : traits_type::eof();
+  }
+  char character = traits_type::to_char_type(c);
+  return WriteWithBuffer(&character, 1) ? c : traits_type::eof();
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer ReadDirect
+//----------------------------------------------------------------------
+ssize_t tFileDescriptorStreamBuffer::ReadDirect(char* data, size_t count)
+{
+  ssize_t bytes_read;
+  do
+  {
+    bytes_read = read(file_descriptor, data, count);
+  }
+  while (bytes_read < 0 && errno == EINTR);
+  return bytes_read;
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer seekoff
+//----------------------------------------------------------------------
+tFileDescriptorStreamBuffer::pos_type tFileDescriptorStreamBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode)
+{
+  if (!FlushWriteBuffer())
+  {
+    return pos_type(off_type(-1));
+  }
+  if (direction == std::ios_base::cur)
+  {
+    offset -= egptr() - gptr();
+  }
+  off_t result = lseek(file_descriptor, offset, direction == std::ios_base::beg ? SEEK_SET : (direction == std::ios_base::cur ? SEEK_CUR : SEEK_END));
+  if (result >= 0 && read_buffer)
+  {
+    setg(read_buffer.get(), read_buffer.get(), read_buffer.get());
+  }
+  return pos_type(off_type(result));
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer seekpos
+//----------------------------------------------------------------------
+tFileDescriptorStreamBuffer::pos_type tFileDescriptorStreamBuffer::seekpos(pos_type position, std::ios_base::openmode which)
+{
+  return seekoff(off_type(position), std::ios_base::beg, which);
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer sync
+//----------------------------------------------------------------------
+int tFileDescriptorStreamBuffer::sync()
+{
+  return FlushWriteBuffer() ? 0 : -1;
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer underflow
+//----------------------------------------------------------------------
+tFileDescriptorStreamBuffer::int_type tFileDescriptorStreamBuffer::underflow()
+{
+  if (!read_buffer || !FlushWriteBuffer())
+  {
+    return traits_type::eof();
+  }
+  if (gptr() == egptr())
+  {
+    ssize_t bytes_read = ReadDirect(read_buffer.get(), buffer_size);
+    if (bytes_read <= 0)
+    {
+      return traits_type::eof();
+    }
+    setg(read_buffer.get(), read_buffer.get(), read_buffer.get() + bytes_read);
+  }
+  return traits_type::to_int_type(*gptr());
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer WriteWithBuffer
+//----------------------------------------------------------------------
+bool tFileDescriptorStreamBuffer::WriteWithBuffer(const char* data, size_t count)
+{
+  if (!write_buffer)
+  {
+    return count == 0;
+  }
+  if (pbase() == pptr() && count == 0)
+  {
+    return true;
+  }
+  DiscardReadAhead();
+
+  struct iovec chunks[2] = { { pbase(), static_cast<size_t>(pptr() - pbase()) }, { const_cast<char*>(data), count } };
+  struct iovec* remaining = chunks[0].iov_len ? &chunks[0] : &chunks[1];
+  size_t remaining_count = &chunks[2] - remaining;
+  setp(write_buffer.get(), write_buffer.get() + buffer_size);
+
+  while (remaining_count > 0)
+  {
+    ssize_t written = writev(file_descriptor, remaining, remaining_count);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return false;
+    }
+    size_t bytes = written;
+    for (; remaining_count > 0 && bytes >= remaining->iov_len; remaining++, remaining_count--)
+    {
+      bytes -= remaining->iov_len;
+    }
+    if (remaining_count > 0)
+    {
+      remaining->iov_base = static_cast<char*>(remaining->iov_base) + bytes;
+      remaining->iov_len -= bytes;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer xsgetn
+//----------------------------------------------------------------------
+std::streamsize tFileDescriptorStreamBuffer::xsgetn(char_type* data, std::streamsize count)
+{
+  std::streamsize copied = 0;
+  while (copied < count)
+  {
+    std::streamsize available = egptr() - gptr();
+    if (available > 0)
+    {
+      std::streamsize chunk = std::min(available, count - copied);
+      memcpy(data + copied, gptr(), chunk);
+      gbump(static_cast<int>(chunk));
+      copied += chunk;
+    }
+    else if (static_cast<size_t>(count - copied) >= buffer_size)
+    {
+      // large reads bypass the buffer
+      if (!read_buffer || !FlushWriteBuffer())
+      {
+        break;
+      }
+      ssize_t bytes_read = ReadDirect(data + copied, count - copied);
+      if (bytes_read <= 0)
+      {
+        break;
+      }
+      copied += bytes_read;
+    }
+    else if (traits_type::eq_int_type(underflow(), traits_type::eof()))
+    {
+      break;
+    }
+  }
+  return copied;
+}
+
+//----------------------------------------------------------------------
+// tFileDescriptorStreamBuffer xsputn
+//----------------------------------------------------------------------
+std::streamsize tFileDescriptorStreamBuffer::xsputn(const char_type* data, std::streamsize count)
+{
+  if (!write_buffer)
+  {
+    return 0;
+  }
+  if (count <= epptr() - pptr())
+  {
+    if (count > 0)
+    {
+      memcpy(pptr(), data, count);
+      pbump(static_cast<int>(count));
+    }
+    return count;
+  }
+  // buffered data and new data are written with a single writev call
+  return WriteWithBuffer(data, count) ? count : 0;
+}
+
+//----------------------------------------------------------------------
+// CopyStreamBuffer
+//----------------------------------------------------------------------
+std::streamsize CopyStreamBuffer(std::streambuf& source, std::streambuf& destination, std::streamsize count)
+{
+  std::streamsize copied = 0;
+  size_t remaining = count < 0 ? std::numeric_limits<size_t>::max() : static_cast<size_t>(count);
+
+  tFileDescriptorStreamBuffer* fd_source = dynamic_cast<tFileDescriptorStreamBuffer*>(&source);
+  tFileDescriptorStreamBuffer* fd_destination = dynamic_cast<tFileDescriptorStreamBuffer*>(&destination);
+  if (fd_source && fd_destination && fd_destination->FlushWriteBuffer() && fd_source->FlushWriteBuffer())
+  {
+    // data that source has already read ahead
+    size_t buffered = std::min<size_t>(fd_source->egptr() - fd_source->gptr(), remaining);
+    if (buffered > 0)
+    {
+      if (!fd_destination->WriteWithBuffer(fd_source->gptr(), buffered))
+      {
+        return copied;
+      }
+      fd_source->gbump(static_cast<int>(buffered));
+      copied += buffered;
+      remaining -= buffered;
+    }
+
+    // remaining data is copied inside the kernel
+    bool use_splice = IsPipe(fd_source->file_descriptor) || IsPipe(fd_destination->file_descriptor);
+    while (remaining > 0)
+    {
+      size_t chunk = std::min(remaining, cMAX_KERNEL_COPY_CHUNK);
+      ssize_t transferred = use_splice ?
+                            splice(fd_source->file_descriptor, nullptr, fd_destination->file_descriptor, nullptr, chunk, SPLICE_F_MOVE) :
+                            sendfile(fd_destination->file_descriptor, fd_source->file_descriptor, nullptr, chunk);
+      if (transferred < 0 && errno == EINTR)
+      {
+        continue;
+      }
+      if (transferred <= 0)
+      {
+        if (transferred < 0 && (errno == EINVAL || errno == ENOSYS))
+        {
+          break;  // not supported for these descriptors: copy via user space below
+        }
+        return copied;
+      }
+      copied += transferred;
+      remaining -= transferred;
+    }
+  }
+
+  std::unique_ptr<char[]> buffer;
+  while (remaining > 0)
+  {
+    if (!buffer)
+    {
+      buffer.reset(new char[cCOPY_BUFFER_SIZE]);
+    }
+    std::streamsize chunk = source.sgetn(buffer.get(), std::min(remaining, cCOPY_BUFFER_SIZE));
+    if (chunk <= 0)
+    {
+      break;
+    }
+    std::streamsize written = destination.sputn(buffer.get(), chunk);
+    copied += written;
+    remaining -= written;
+    if (written < chunk)
+    {
+      break;
+    }
+  }
+  return copied;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,249 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/fstream/tFileDescriptorStreamBuffer.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tFileDescriptorStreamBuffer
+ *
+ * \b tFileDescriptorStreamBuffer
+ *
+ * A std::streambuf that operates directly on a POSIX file descriptor.
+ *
+ * This is the opposite direction of GetFileDescriptor: instead of digging
+ * the descriptor out of a standard stream buffer, existing iostream based
+ * code is given a stream buffer on top of a descriptor. std::filebuf
+ * copies all data through a small internal buffer (and stdio's, when
+ * synced). This class uses one large buffer per direction, bypasses it for
+ * large reads and writes, and flushes pending data together with the next
+ * chunk using a single writev call.
+ *
+ * CopyStreamBuffer copies between two such stream buffers using splice or
+ * sendfile - so the data is not copied to user space at all.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__fstream__tFileDescriptorStreamBuffer_h__
+#define __rrlib__util__fstream__tFileDescriptorStreamBuffer_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <streambuf>
+#include <string>
+#include <memory>
+
+extern "C"
+{
+#include <fcntl.h>
+}
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Stream buffer on a raw file descriptor
+/*!
+ * Buffered std::streambuf for reading from and/or writing to a file
+ * descriptor (files, pipes, sockets, terminals).
+ *
+ * Reads and writes that are at least as large as the buffer do not
+ * pass through it: reads go directly to the caller's memory, writes are
+ * combined with pending buffered data in one writev call.
+ *
+ * If the stream buffer is opened for reading and writing, read-ahead
+ * data is discarded (by seeking back) before writing - so on seekable
+ * files both directions share one file position as with std::filebuf.
+ *
+ * Usage:
+ *
+ *   tFileDescriptorStreamBuffer buffer("data.bin", std::ios_base::out);
+ *   std::ostream stream(&buffer);
+ *   stream << ...;
+ */
+class tFileDescriptorStreamBuffer : public std::streambuf, private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Default size of read and write buffers */
+  static const size_t cDEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+  /*!
+   * Operates on an open file descriptor (the stream buffer does not close it)
+   *
+   * \param file_descriptor File descriptor to read from and/or write to
+   * \param mode Whether to read (std::ios_base::in) and/or write (std::ios_base::out)
+   * \param buffer_size Size of read and write buffers
+   */
+  tFileDescriptorStreamBuffer(int file_descriptor, std::ios_base::openmode mode, size_t buffer_size = cDEFAULT_BUFFER_SIZE);
+
+  /*!
+   * Opens the specified file (which is closed on destruction)
+   *
+   * Files opened for writing only are created and truncated (as with std::ofstream).
+   * Files opened for reading only are advised to be read sequentially.
+   *
+   * \param file_name Name of file to open
+   * \param mode Open mode (in, out, app and trunc are supported)
+   * \param buffer_size Size of read and write buffers
+   * \throws runtime_error if file cannot be opened
+   */
+  tFileDescriptorStreamBuffer(const std::string& file_name, std::ios_base::openmode mode, size_t buffer_size = cDEFAULT_BUFFER_SIZE);
+
+  ~tFileDescriptorStreamBuffer();
+
+  /*!
+   * Passes an access pattern hint for the file to the kernel (see posix_fadvise)
+   *
+   * \param advice One of the POSIX_FADV_* constants
+   * \param offset Start of the affected region
+   * \param length Length of the affected region (0 means until end of file)
+   * \return Whether the hint was accepted (it is not for e.g. pipes)
+   */
+  bool Advise(int advice, off_t offset = 0, off_t length = 0);
+
+  /*!
+   * \return File descriptor this stream buffer operates on
+   */
+  int FileDescriptor() const
+  {
+    return file_descriptor;
+  }
+
+//----------------------------------------------------------------------
+// Protected methods
+//----------------------------------------------------------------------
+protected:
+
+  virtual int_type overflow(int_type c) override;
+
+  virtual pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override;
+
+  virtual pos_type seekpos(pos_type position, std::ios_base::openmode which) override;
+
+  virtual int sync() override;
+
+  virtual int_type underflow() override;
+
+  virtual std::streamsize xsgetn(char_type* data, std::streamsize count) override;
+
+  virtual std::streamsize xsputn(const char_type* data, std::streamsize count) override;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  friend std::streamsize CopyStreamBuffer(std::streambuf& source, std::streambuf& destination, std::streamsize count);
+
+  /*! File descriptor to read from and/or write to */
+  int file_descriptor;
+
+  /*! Whether file descriptor is closed on destruction */
+  bool close_file_descriptor;
+
+  /*! Size of read and write buffers */
+  size_t buffer_size;
+
+  /*! Read buffer (null if not opened for reading) */
+  std::unique_ptr<char[]> read_buffer;
+
+  /*! Write buffer (null if not opened for writing) */
+  std::unique_ptr<char[]> write_buffer;
+
+
+  /*!
+   * Discards data that was read ahead - and moves file position back to the logical read position if possible
+   */
+  void DiscardReadAhead();
+
+  /*!
+   * Writes buffered data
+   *
+   * \return Whether all data was written
+   */
+  bool FlushWriteBuffer()
+  {
+    return WriteWithBuffer(nullptr, 0);
+  }
+
+  /*!
+   * Reads directly into the provided memory (retries if interrupted)
+   *
+   * \return Number of bytes read (0 at end of file, -1 on error)
+   */
+  ssize_t ReadDirect(char* data, size_t count);
+
+  /*!
+   * Writes buffered data followed by the provided data - using a single writev call if possible.
+   * Write buffer is empty afterwards.
+   *
+   * \return Whether all data was written (false if data is provided and the buffer was not opened for writing)
+   */
+  bool WriteWithBuffer(const char* data, size_t count);
+};
+
+/*!
+ * Copies data from one stream buffer to another
+ *
+ * If both are tFileDescriptorStreamBuffer, data is copied inside the kernel
+ * using splice (if source or destination is a pipe) or sendfile. Otherwise -
+ * or if the kernel does not support this for the descriptors - data is
+ * copied with sgetn and sputn.
+ *
+ * \param source Stream buffer to read data from
+ * \param destination Stream buffer to write data to
+ * \param count Maximum number of bytes to copy (-1 copies until end of source)
+ * \return Number of bytes copied
+ */
+std::streamsize CopyStreamBuffer(std::streambuf& source, std::streambuf& destination, std::streamsize count = -1);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
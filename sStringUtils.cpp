@@ -151,6 +151,35 @@ bool sStringUtils::BeginsWith(const std::string& text, const std::string& elemen
   return util::StartsWith(text, element);
 }
 
+bool sStringUtils::SortStringVector(std::vector<std::string> &vec)
+{
+  // Schwartzian transform: fold case once per string and sort the (key, index) pairs
+  std::vector<std::pair<std::string, size_t>> keys;
+  keys.reserve(vec.size());
+  for (size_t i = 0; i < vec.size(); i++)
+  {
+    std::string key(vec[i]);
+    for (char & c : key)
+    {
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    keys.emplace_back(std::move(key), i);
+  }
+  std::sort(keys.begin(), keys.end(), [](const std::pair<std::string, size_t>& left, const std::pair<std::string, size_t>& right)
+  {
+    return left.first < right.first;
+  });
+
+  std::vector<std::string> sorted;
+  sorted.reserve(vec.size());
+  for (auto & key : keys)
+  {
+    sorted.push_back(std::move(vec[key.second]));
+  }
+  vec.swap(sorted);
+  return true;
+}
+
 bool sStringUtils::StringToBool(std::string s)
 {
   if ((s == "true") || (s == "1"))
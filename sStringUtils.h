@@ -77,6 +77,7 @@ std::basic_istream<Ch, Tr>& operator>>(std::basic_istream<Ch, Tr>& is, imanip m)
 
 /*!
     Stream manipulator implementation for reading a string from actual position within the stream up to the end of line.
+    (For reading large files line by line, tLineReader [rrlib/util/tLineReader.h] is a lot more efficient.)
 */
 inline std::istream& get_line(std::istream& fin, std::string& str)
 {
@@ -108,21 +109,6 @@ inline std::istream& get_line(std::istream& fin, std::string& str)
 class sStringUtils
 {
 
-private:
-
-  static bool StringCompare(const std::string &left, const std::string &right)
-  {
-    for (std::string::const_iterator lit = left.begin(), rit = right.begin(); lit != left.end() && rit != right.end(); ++lit, ++rit)
-      if (std::tolower(*lit) < std::tolower(*rit))
-        return true;
-      else if (std::tolower(*lit) > std::tolower(*rit))
-        return false;
-    if (left.size() < right.size())
-      return true;
-    return false;
-  }
-
-
 public:
 
   static const char* Description()
@@ -374,12 +360,18 @@ public:
   }
 
 
-  static bool SortStringVector(std::vector<std::string> &vec)
-  {
-    std::sort(vec.begin(), vec.end(), StringCompare);
-    return true;
-  }
+  /*!
+   * \brief Sorts the provided strings case-insensitively
+   *
+   * Lower case keys are computed only once per string (not on every comparison).
+   */
+  static bool SortStringVector(std::vector<std::string> &vec);
 
+  /*!
+   * \brief Returns index of str in str_array (-1 if it is not contained)
+   *
+   * Performs a linear search. For arrays that are searched repeatedly, use tStringIndex [rrlib/util/tStringIndex.h].
+   */
   static int FindStringInArray(const char* str, char*const* str_array, size_t num_str_in_array)
   {
     char*const* descr_begin(&str_array[0]);
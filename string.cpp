@@ -32,6 +32,12 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <cstdint>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -66,6 +72,155 @@ namespace util
 // Implementation
 //----------------------------------------------------------------------
 
+namespace
+{
+
+inline char ToLowerAscii(char c)
+{
+  return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+/*!
+ * Converts the ASCII letters in all 8 bytes of 'word' to lower case (SWAR)
+ */
+inline uint64_t ToLowerAscii(uint64_t word)
+{
+  const uint64_t cONES = 0x0101010101010101ull;
+  const uint64_t cHIGH_BITS = 0x8080808080808080ull;
+  uint64_t heptets = word & ~cHIGH_BITS;
+  uint64_t greater_than_z = heptets + (0x7F - 'Z') * cONES;
+  uint64_t at_least_a = heptets + (0x80 - 'A') * cONES;
+  uint64_t upper_case = (at_least_a ^ greater_than_z) & ~word & cHIGH_BITS;
+  return word | (upper_case >> 2);
+}
+
+#ifdef __SSE2__
+/*!
+ * Converts the ASCII letters in all 16 bytes of 'block' to lower case
+ */
+inline __m128i ToLowerAscii(__m128i block)
+{
+  // bytes >= 0x80 are negative in signed comparison and therefore not in range
+  __m128i upper_case = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('Z' + 1)));
+  return _mm_or_si128(block, _mm_and_si128(upper_case, _mm_set1_epi8(0x20)));
+}
+#endif
+
+/*!
+ * \return Index of first character in which the two buffers differ when ignoring case - or 'length' if they do not differ
+ */
+size_t MismatchIgnoreCase(const char* buffer1, const char* buffer2, size_t length)
+{
+  size_t i = 0;
+#ifdef __SSE2__
+  for (; i + 16 <= length; i += 16)
+  {
+    __m128i block1 = ToLowerAscii(_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer1 + i)));
+    __m128i block2 = ToLowerAscii(_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer2 + i)));
+    unsigned int equal_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block1, block2));
+    if (equal_mask != 0xFFFF)
+    {
+      return i + __builtin_ctz(~equal_mask);
+    }
+  }
+#endif
+  for (; i + 8 <= length; i += 8)
+  {
+    uint64_t word1, word2;
+    memcpy(&word1, buffer1 + i, 8);
+    memcpy(&word2, buffer2 + i, 8);
+    if (ToLowerAscii(word1) != ToLowerAscii(word2))
+    {
+      break;
+    }
+  }
+  for (; i < length; i++)
+  {
+    if (ToLowerAscii(buffer1[i]) != ToLowerAscii(buffer2[i]))
+    {
+      return i;
+    }
+  }
+  return length;
+}
+
+}
+
+int CompareIgnoreCase(std::string_view string1, std::string_view string2)
+{
+  size_t common_length = std::min(string1.length(), string2.length());
+  size_t mismatch = MismatchIgnoreCase(string1.data(), string2.data(), common_length);
+  if (mismatch < common_length)
+  {
+    return static_cast<int>(static_cast<unsigned char>(ToLowerAscii(string1[mismatch]))) - static_cast<int>(static_cast<unsigned char>(ToLowerAscii(string2[mismatch])));
+  }
+  return string1.length() < string2.length() ? -1 : (string1.length() > string2.length() ? 1 : 0);
+}
+
+bool EqualsIgnoreCase(std::string_view string1, std::string_view string2)
+{
+  return string1.length() == string2.length() && MismatchIgnoreCase(string1.data(), string2.data(), string1.length()) == string1.length();
+}
+
+size_t HashIgnoreCase(std::string_view string)
+{
+  uint64_t hash = 0x9e3779b97f4a7c15ull ^ string.length();
+  for (size_t i = 0; i < string.length(); i += 8)
+  {
+    uint64_t word = 0;
+    memcpy(&word, string.data() + i, std::min<size_t>(8, string.length() - i));
+    hash = (hash ^ ToLowerAscii(word)) * 0xff51afd7ed558ccdull;
+    hash = (hash << 29) | (hash >> 35);
+  }
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return static_cast<size_t>(hash);
+}
+
+size_t FindIgnoreCase(std::string_view string, std::string_view substring, size_t position)
+{
+  if (string.length() < substring.length() || position > string.length() - substring.length())
+  {
+    return std::string::npos;
+  }
+  if (substring.empty())
+  {
+    return position;
+  }
+
+  const size_t last_position = string.length() - substring.length();
+  const char first_char = ToLowerAscii(substring[0]);
+  const size_t remaining_length = substring.length() - 1;
+  size_t i = position;
+#ifdef __SSE2__
+  // find candidates by comparing first character at 16 positions at once
+  const __m128i first_char_block = _mm_set1_epi8(first_char);
+  for (; i + 15 <= last_position; i += 16)
+  {
+    __m128i block = ToLowerAscii(_mm_loadu_si128(reinterpret_cast<const __m128i*>(string.data() + i)));
+    unsigned int candidate_mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, first_char_block));
+    while (candidate_mask)
+    {
+      size_t candidate = i + __builtin_ctz(candidate_mask);
+      if (MismatchIgnoreCase(string.data() + candidate + 1, substring.data() + 1, remaining_length) == remaining_length)
+      {
+        return candidate;
+      }
+      candidate_mask &= candidate_mask - 1;
+    }
+  }
+#endif
+  for (; i <= last_position; i++)
+  {
+    if (ToLowerAscii(string[i]) == first_char && MismatchIgnoreCase(string.data() + i + 1, substring.data() + 1, remaining_length) == remaining_length)
+    {
+      return i;
+    }
+  }
+  return std::string::npos;
+}
+
 void TrimWhitespace(std::string& string)
 {
   size_t start_pos = 0;
@@ -84,18 +239,18 @@ void TrimWhitespace(std::string& string)
   }
 }
 
-void Tokenize(const std::string& str, std::vector<std::string>& tokens, const std::string& delimiters)
+void Tokenize(std::string_view str, std::vector<std::string>& tokens, std::string_view delimiters)
 {
   tokens.clear();
   // Skip delimiters at beginning.
-  std::string::size_type last_pos = str.find_first_not_of(delimiters, 0);
+  std::string_view::size_type last_pos = str.find_first_not_of(delimiters, 0);
   // Find first "non-delimiter".
-  std::string::size_type pos     = str.find_first_of(delimiters, last_pos);
+  std::string_view::size_type pos     = str.find_first_of(delimiters, last_pos);
 
-  while (std::string::npos != pos || std::string::npos != last_pos)
+  while (std::string_view::npos != pos || std::string_view::npos != last_pos)
   {
     // Found a token, add it to the vector.
-    tokens.push_back(str.substr(last_pos, pos - last_pos));
+    tokens.emplace_back(str.substr(last_pos, pos - last_pos));
     // Skip delimiters.  Note the "not_of"
     last_pos = str.find_first_not_of(delimiters, pos);
     // Find next "non-delimiter"
@@ -53,6 +53,8 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <string>
+#include <string_view>
+#include <vector>
 #include <cstring>
 
 //----------------------------------------------------------------------
@@ -79,29 +81,11 @@ namespace util
  * \param string String to check
  * \param suffix Suffix
  * \return True if string ends with the provided suffix (true also if suffix is the empty string)
- *
- * (for efficiency reasons, there are 4 overloads)
  */
-inline bool EndsWith(const std::string& string, const std::string& suffix)
+inline bool EndsWith(std::string_view string, std::string_view suffix)
 {
   return string.length() >= suffix.length() && (string.compare(string.length() - suffix.length(), suffix.length(), suffix) == 0);
 }
-inline bool EndsWith(const std::string& string, const char* suffix)
-{
-  size_t suffix_length = strlen(suffix);
-  return string.length() >= suffix_length && (string.compare(string.length() - suffix_length, suffix_length, suffix) == 0);
-}
-inline bool EndsWith(const char* string, const std::string& suffix)
-{
-  size_t string_length = strlen(string);
-  return string_length >= suffix.length() && (suffix.compare(0, suffix.length(), string + (string_length - suffix.length()), suffix.length()) == 0);
-}
-inline bool EndsWith(const char* string, const char* suffix)
-{
-  size_t string_length = strlen(string);
-  size_t suffix_length = strlen(suffix);
-  return string_length >= suffix_length && (strncmp(string + (string_length - suffix_length), suffix, suffix_length) == 0);
-}
 
 
 /*!
@@ -109,25 +93,90 @@ inline bool EndsWith(const char* string, const char* suffix)
  * \param prefix Prefix
  * \return True if string starts with the provided prefix (true also if prefix is the empty string)
  *
- * (for efficiency reasons, there are 4 overloads)
+ * (overloads for C strings stop at the first mismatch and do not determine the length of 'string')
  */
-inline bool StartsWith(const std::string& string, const std::string& prefix)
+inline bool StartsWith(std::string_view string, std::string_view prefix)
 {
-  return string.compare(0, prefix.length(), prefix) == 0;
+  return string.substr(0, prefix.length()) == prefix;
 }
-inline bool StartsWith(const std::string& string, const char* prefix)
+inline bool StartsWith(const char* string, std::string_view prefix)
 {
-  return string.compare(0, strlen(prefix), prefix) == 0;
+  for (size_t i = 0; i < prefix.length(); i++)
+  {
+    if (string[i] == 0 || string[i] != prefix[i])
+    {
+      return false;
+    }
+  }
+  return true;
 }
-inline bool StartsWith(const char* string, const std::string& prefix)
+inline bool StartsWith(const char* string, const char* prefix)
 {
-  return prefix.compare(0, prefix.length(), string, prefix.length()) == 0;
+  for (; *prefix; string++, prefix++)
+  {
+    if (*string != *prefix)
+    {
+      return false;
+    }
+  }
+  return true;
 }
-inline bool StartsWith(const char* string, const char* prefix)
+
+/*!
+ * Case-insensitive comparison of two strings.
+ * Only ASCII letters are folded (independent of locale); all other bytes
+ * are compared as unsigned char values.
+ * No temporary copies of the strings are created.
+ *
+ * \param string1 First string
+ * \param string2 Second string
+ * \return Negative value if string1 is ordered before string2, zero if both are equal (ignoring case), positive value otherwise
+ */
+int CompareIgnoreCase(std::string_view string1, std::string_view string2);
+
+/*!
+ * \param string1 First string
+ * \param string2 Second string
+ * \return True if both strings are equal when ignoring the case of ASCII letters
+ */
+bool EqualsIgnoreCase(std::string_view string1, std::string_view string2);
+
+/*!
+ * \param string String to compute hash value for
+ * \return Hash value of string that ignores the case of ASCII letters (equal for strings that EqualsIgnoreCase)
+ */
+size_t HashIgnoreCase(std::string_view string);
+
+/*!
+ * \param string String to check
+ * \param prefix Prefix
+ * \return True if string starts with the provided prefix when ignoring the case of ASCII letters
+ */
+inline bool StartsWithIgnoreCase(std::string_view string, std::string_view prefix)
 {
-  return strncmp(string, prefix, strlen(prefix)) == 0;
+  return string.length() >= prefix.length() && EqualsIgnoreCase(string.substr(0, prefix.length()), prefix);
 }
 
+/*!
+ * \param string String to check
+ * \param suffix Suffix
+ * \return True if string ends with the provided suffix when ignoring the case of ASCII letters
+ */
+inline bool EndsWithIgnoreCase(std::string_view string, std::string_view suffix)
+{
+  return string.length() >= suffix.length() && EqualsIgnoreCase(string.substr(string.length() - suffix.length()), suffix);
+}
+
+/*!
+ * Searches for substring in string - ignoring the case of ASCII letters
+ *
+ * \param string String to search in
+ * \param substring String to search for
+ * \param position Position in string to start search at
+ * \return Position of the first occurrence of substring at or after 'position' - or std::string::npos if there is none
+ */
+size_t FindIgnoreCase(std::string_view string, std::string_view substring, size_t position = 0);
+
 /*!
  * Removes whitespace from the beginning and the end of the string
  *
@@ -142,7 +191,7 @@ void TrimWhitespace(std::string& string);
  * \param tokens The list of tokens (vector object contains the found tokens after the function returns. The function calls clear() on the vector - so it does not contain any previous elements.).
  * \param delimiters The delimiters (as provided to std::string::find_first_of)
  */
-void Tokenize(const std::string& str, std::vector<std::string>& tokens, const std::string& delimiters);
+void Tokenize(std::string_view str, std::vector<std::string>& tokens, std::string_view delimiters);
 
 
 //----------------------------------------------------------------------
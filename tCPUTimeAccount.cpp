@@ -0,0 +1,285 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tCPUTimeAccount.cpp
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tCPUTimeAccount.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+extern "C"
+{
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+}
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tCPUTimeAccount::cMAX_ACCOUNTS;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * CPU time booked by one thread.
+ * Only written by the owning thread - so the atomics need no read-modify-write operations.
+ */
+struct tThreadRecord
+{
+  long thread_id;
+  std::string thread_name;
+  std::atomic<long long> cpu_time_nsec[tCPUTimeAccount::cMAX_ACCOUNTS];
+  std::atomic<uint64_t> count[tCPUTimeAccount::cMAX_ACCOUNTS];
+
+  tThreadRecord() :
+    thread_id(syscall(SYS_gettid))
+  {
+    char name[32] = "";
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    thread_name = name;
+    Reset();
+  }
+
+  tThreadRecord(long thread_id, const std::string& thread_name) :
+    thread_id(thread_id),
+    thread_name(thread_name)
+  {
+    Reset();
+  }
+
+  void Reset()
+  {
+    for (size_t i = 0; i < tCPUTimeAccount::cMAX_ACCOUNTS; i++)
+    {
+      cpu_time_nsec[i].store(0, std::memory_order_relaxed);
+      count[i].store(0, std::memory_order_relaxed);
+    }
+  }
+};
+
+struct tRegistry
+{
+  std::mutex mutex;
+  std::deque<std::string> account_names;  // deque: references to names remain valid
+  std::vector<std::unique_ptr<tThreadRecord>> threads;
+
+  /*! Totals of all threads that have terminated (only accessed with mutex locked) */
+  tThreadRecord terminated_threads;
+
+  tRegistry() :
+    terminated_threads(0, "terminated threads")
+  {}
+};
+
+tRegistry& Registry()
+{
+  // never deleted: threads may still book CPU time during static destruction
+  static tRegistry* registry = new tRegistry();
+  return *registry;
+}
+
+thread_local tThreadRecord* current_thread_record = nullptr;
+thread_local bool current_thread_record_retired = false;
+
+/*!
+ * Destroyed when its thread terminates: folds the thread's totals into
+ * tRegistry::terminated_threads and frees the thread's record - so that
+ * memory does not grow with every thread ever created (e.g. in worker pools).
+ */
+struct tThreadRecordRetirement
+{
+  ~tThreadRecordRetirement()
+  {
+    tThreadRecord* record = current_thread_record;
+    if (!record)
+    {
+      return;
+    }
+    tRegistry& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (size_t i = 0; i < tCPUTimeAccount::cMAX_ACCOUNTS; i++)
+    {
+      std::atomic<long long>& cpu_time_nsec = registry.terminated_threads.cpu_time_nsec[i];
+      std::atomic<uint64_t>& count = registry.terminated_threads.count[i];
+      cpu_time_nsec.store(cpu_time_nsec.load(std::memory_order_relaxed) + record->cpu_time_nsec[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+      count.store(count.load(std::memory_order_relaxed) + record->count[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    for (auto it = registry.threads.begin(); it != registry.threads.end(); ++it)
+    {
+      if (it->get() == record)
+      {
+        registry.threads.erase(it);
+        break;
+      }
+    }
+    current_thread_record = nullptr;
+    current_thread_record_retired = true;
+  }
+};
+
+tThreadRecord& CurrentThreadRecord()
+{
+  if (!current_thread_record)
+  {
+    std::unique_ptr<tThreadRecord> record(new tThreadRecord());
+    current_thread_record = record.get();
+    if (!current_thread_record_retired)
+    {
+      thread_local tThreadRecordRetirement retirement;
+      (void)retirement;
+    }
+    // else: thread books CPU time while its thread_local objects are destroyed - record is kept until process terminates
+    tRegistry& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.threads.push_back(std::move(record));
+  }
+  return *current_thread_record;
+}
+
+}
+
+//----------------------------------------------------------------------
+// tCPUTimeAccount constructors
+//----------------------------------------------------------------------
+tCPUTimeAccount::tCPUTimeAccount(const std::string& name)
+{
+  tRegistry& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  if (registry.account_names.size() >= cMAX_ACCOUNTS)
+  {
+    throw std::length_error("Maximum number of CPU time accounts exceeded");
+  }
+  index = registry.account_names.size();
+  registry.account_names.push_back(name);
+}
+
+//----------------------------------------------------------------------
+// tCPUTimeAccount Book
+//----------------------------------------------------------------------
+void tCPUTimeAccount::Book(const tTime& cpu_time)
+{
+  tThreadRecord& record = CurrentThreadRecord();
+  record.cpu_time_nsec[index].store(record.cpu_time_nsec[index].load(std::memory_order_relaxed) + cpu_time.ToNSec(), std::memory_order_relaxed);
+  record.count[index].store(record.count[index].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------
+// tCPUTimeAccount GetName
+//----------------------------------------------------------------------
+const std::string& tCPUTimeAccount::GetName() const
+{
+  tRegistry& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.account_names[index];
+}
+
+//----------------------------------------------------------------------
+// tCPUTimeAccount GetThreadCount
+//----------------------------------------------------------------------
+uint64_t tCPUTimeAccount::GetThreadCount() const
+{
+  return CurrentThreadRecord().count[index].load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------
+// tCPUTimeAccount GetThreadCPUTime
+//----------------------------------------------------------------------
+tTime tCPUTimeAccount::GetThreadCPUTime() const
+{
+  return tTime().FromNSec(CurrentThreadRecord().cpu_time_nsec[index].load(std::memory_order_relaxed));
+}
+
+//----------------------------------------------------------------------
+// GetCPUTimeUsage
+//----------------------------------------------------------------------
+std::vector<tCPUTimeUsage> GetCPUTimeUsage()
+{
+  std::vector<tCPUTimeUsage> result;
+  tRegistry& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto add_usage = [&](const tThreadRecord & thread)
+  {
+    for (size_t i = 0; i < registry.account_names.size(); i++)
+    {
+      uint64_t count = thread.count[i].load(std::memory_order_relaxed);
+      if (count)
+      {
+        result.push_back(tCPUTimeUsage { thread.thread_id, thread.thread_name, registry.account_names[i], tTime().FromNSec(thread.cpu_time_nsec[i].load(std::memory_order_relaxed)), count });
+      }
+    }
+  };
+  for (auto & thread : registry.threads)
+  {
+    add_usage(*thread);
+  }
+  add_usage(registry.terminated_threads);
+  return result;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,225 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tCPUTimeAccount.h
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tCPUTimeAccount and tScopedCPUTime
+ *
+ * \b tCPUTimeAccount
+ *
+ * Named account that the CPU time spent in code regions is booked to -
+ * separately for every thread. This allows e.g. checking the CPU load
+ * of periodic tasks against their budget.
+ *
+ * \b tScopedCPUTime
+ *
+ * Books the CPU time that the current thread spends in the enclosing
+ * scope to a tCPUTimeAccount.
+ *
+ * Usage:
+ *
+ *   static tCPUTimeAccount cCONTROL_LOOP_ACCOUNT("Control loop");
+ *   ...
+ *   {
+ *     tScopedCPUTime cpu_time(cCONTROL_LOOP_ACCOUNT);
+ *     ...
+ *   }
+ *   ...
+ *   for (const tCPUTimeUsage& usage : GetCPUTimeUsage())
+ *   {
+ *     ...
+ *   }
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tCPUTimeAccount_h__
+#define __rrlib__util__tCPUTimeAccount_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include "rrlib/util/tTime.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! CPU time booked by one thread to one account */
+struct tCPUTimeUsage
+{
+  /*! Kernel thread id (as shown by e.g. top) - 0 for the totals of all terminated threads */
+  long thread_id;
+
+  /*! Name of thread (at the time it first booked CPU time) - "terminated threads" for the totals of all terminated threads */
+  std::string thread_name;
+
+  /*! Name of account */
+  std::string account_name;
+
+  /*! Total CPU time booked */
+  tTime cpu_time;
+
+  /*! Number of times CPU time was booked (e.g. number of executions of region) */
+  uint64_t count;
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Named account for CPU time
+/*!
+ * Account that the CPU time of code regions is booked to (typically via
+ * tScopedCPUTime). CPU time is accounted separately for every thread.
+ *
+ * Accounts are typically static objects. Their data (including the name)
+ * is kept after an account is destroyed - so creating accounts
+ * dynamically over and over is not supported.
+ *
+ * Booking CPU time is cheap (two clock_gettime calls per region and no
+ * synchronization between threads).
+ */
+class tCPUTimeAccount : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Maximum number of accounts */
+  static const size_t cMAX_ACCOUNTS = 128;
+
+  /*!
+   * \param name Name of account
+   * \throws std::length_error if there are already cMAX_ACCOUNTS accounts
+   */
+  explicit tCPUTimeAccount(const std::string& name);
+
+  /*!
+   * Books CPU time of the current thread to this account
+   *
+   * \param cpu_time CPU time to book
+   */
+  void Book(const tTime& cpu_time);
+
+  /*!
+   * \return CPU time that the current thread has booked to this account
+   */
+  tTime GetThreadCPUTime() const;
+
+  /*!
+   * \return Number of times the current thread has booked CPU time to this account
+   */
+  uint64_t GetThreadCount() const;
+
+  /*!
+   * \return Name of account
+   */
+  const std::string& GetName() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Index of account */
+  size_t index;
+};
+
+//! Books CPU time of a scope
+/*!
+ * Books the CPU time that the current thread spends in the enclosing
+ * scope (from construction to destruction of this object) to a
+ * tCPUTimeAccount.
+ *
+ * Regions may be nested. CPU time of inner regions is included in the
+ * CPU time of outer regions.
+ */
+class tScopedCPUTime : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param account Account to book CPU time to
+   */
+  explicit tScopedCPUTime(tCPUTimeAccount& account) :
+    account(account),
+    start(tTime::TaskTime())
+  {}
+
+  ~tScopedCPUTime()
+  {
+    account.Book(tTime::TaskTime() - start);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Account to book CPU time to */
+  tCPUTimeAccount& account;
+
+  /*! CPU time of thread on construction */
+  tTime start;
+};
+
+/*!
+ * Collects CPU time booked to all accounts by all threads.
+ * CPU time of threads that have terminated is included - summed up in
+ * entries with thread_id 0 (one per account).
+ *
+ * \return Entry for every thread and account that thread booked CPU time to
+ */
+std::vector<tCPUTimeUsage> GetCPUTimeUsage();
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
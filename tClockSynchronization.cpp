@@ -0,0 +1,160 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tClockSynchronization.cpp
+ *
+ * \author  Bernd Helge Schaefer
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tClockSynchronization.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tClockSynchronization constructors
+//----------------------------------------------------------------------
+tClockSynchronization::tClockSynchronization(size_t window_size) :
+  samples(window_size > 0 ? window_size : 1)
+{
+  Reset();
+}
+
+//----------------------------------------------------------------------
+// tClockSynchronization AddSample
+//----------------------------------------------------------------------
+void tClockSynchronization::AddSample(const tTime& source_time, const tTime& target_time)
+{
+  tSample sample = { source_time.ToNSec(), target_time.ToNSec() };
+  if (sample_count < samples.size())
+  {
+    samples[(oldest_sample + sample_count) % samples.size()] = sample;
+    sample_count++;
+  }
+  else
+  {
+    samples[oldest_sample] = sample;
+    oldest_sample = (oldest_sample + 1) % samples.size();
+  }
+  Estimate();
+}
+
+//----------------------------------------------------------------------
+// tClockSynchronization Estimate
+//----------------------------------------------------------------------
+void tClockSynchronization::Estimate()
+{
+  // regression of offset (target - source) over source time - relative to oldest pair in order to keep numbers small
+  const tSample& oldest = samples[oldest_sample];
+  long long reference_offset = oldest.target - oldest.source;
+  double x_sum = 0, y_sum = 0;
+  for (size_t i = 0; i < sample_count; i++)
+  {
+    const tSample& sample = samples[(oldest_sample + i) % samples.size()];
+    x_sum += static_cast<double>(sample.source - oldest.source);
+    y_sum += static_cast<double>(sample.target - sample.source - reference_offset);
+  }
+  double x_mean = x_sum / sample_count, y_mean = y_sum / sample_count;
+  double covariance = 0, variance = 0;
+  for (size_t i = 0; i < sample_count; i++)
+  {
+    const tSample& sample = samples[(oldest_sample + i) % samples.size()];
+    double dx = static_cast<double>(sample.source - oldest.source) - x_mean;
+    double dy = static_cast<double>(sample.target - sample.source - reference_offset) - y_mean;
+    covariance += dx * dy;
+    variance += dx * dx;
+  }
+
+  skew = variance > 0 ? covariance / variance : 0;
+  reference = oldest.source;
+  offset = reference_offset + std::llround(y_mean - skew * x_mean);
+}
+
+//----------------------------------------------------------------------
+// tClockSynchronization Reset
+//----------------------------------------------------------------------
+void tClockSynchronization::Reset()
+{
+  oldest_sample = 0;
+  sample_count = 0;
+  reference = 0;
+  offset = 0;
+  skew = 0;
+}
+
+//----------------------------------------------------------------------
+// tClockSynchronization Transform
+//----------------------------------------------------------------------
+void tClockSynchronization::Transform(const tTime* source_times, tTime* target_times, size_t count) const
+{
+  // coefficients in locals: loop contains no loads except the timestamps (the compiler may vectorize it)
+  const long long offset = this->offset, reference = this->reference;
+  const double skew = this->skew;
+  for (size_t i = 0; i < count; i++)
+  {
+    long long source = source_times[i].ToNSec();
+    target_times[i].FromNSec(source + offset + static_cast<long long>(skew * static_cast<double>(source - reference)));
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
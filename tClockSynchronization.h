@@ -0,0 +1,216 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tClockSynchronization.h
+ *
+ * \author  Bernd Helge Schaefer
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tClockSynchronization
+ *
+ * \b tClockSynchronization
+ *
+ * Transforms timestamps from one time base (e.g. the clock of a sensor)
+ * to another one (e.g. the host's clock).
+ *
+ * tTransformTime only applies the offset of the last pair of timestamps.
+ * If the clocks run at slightly different rates (drift - typically tens
+ * of ppm for quartz oscillators), the error grows with the time since
+ * the last pair. This class estimates offset and skew (relative rate
+ * difference) from the last N pairs of timestamps by linear regression.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tClockSynchronization_h__
+#define __rrlib__util__tClockSynchronization_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tTime.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Clock synchronization with offset and skew estimation
+/*!
+ * Estimates the relation between two clocks from pairs of timestamps
+ * (the same instant in source and target time base - e.g. sensor
+ * timestamp and host reception time):
+ *
+ *   target = source + offset + skew * (source - reference)
+ *
+ * Offset and skew are obtained by least squares regression over the last
+ * 'window_size' pairs. With a single pair, only the offset is applied
+ * (like tTransformTime).
+ *
+ * Transforming timestamps is cheap (one multiplication and two additions);
+ * whole arrays of timestamps can be transformed with a single call.
+ *
+ * Note: Least squares is sensitive to outliers. If pairs are obtained via
+ * e.g. a network with varying latency, only pairs with low latency should
+ * be added.
+ */
+class tClockSynchronization
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param window_size Number of most recent pairs of timestamps used for estimation
+   */
+  explicit tClockSynchronization(size_t window_size = 64);
+
+  /*!
+   * Adds pair of timestamps and updates estimation
+   *
+   * \param source_time Time in source time base
+   * \param target_time Same instant in target time base
+   */
+  void AddSample(const tTime& source_time, const tTime& target_time);
+
+  /*!
+   * Same as AddSample() (for migration from tTransformTime)
+   */
+  void ChangeTimeBase(const tTime& transformante_time_base, const tTime& transformer_time_base)
+  {
+    AddSample(transformante_time_base, transformer_time_base);
+  }
+
+  /*!
+   * \return Offset (target minus source time) at the reference source time (the oldest pair in window)
+   */
+  tTime GetOffset() const
+  {
+    return tTime().FromNSec(offset);
+  }
+
+  /*!
+   * \return Reference source time that GetOffset() refers to
+   */
+  tTime GetReferenceTime() const
+  {
+    return tTime().FromNSec(reference);
+  }
+
+  /*!
+   * \return Estimated skew: rate of target clock relative to source clock minus one (e.g. 1e-5 for 10 ppm)
+   */
+  double GetSkew() const
+  {
+    return skew;
+  }
+
+  /*!
+   * \return Number of pairs of timestamps currently used for estimation
+   */
+  size_t SampleCount() const
+  {
+    return sample_count;
+  }
+
+  /*!
+   * Removes all pairs of timestamps
+   */
+  void Reset();
+
+  /*!
+   * \param source_time Time in source time base
+   * \return Time in target time base (source_time if no pair of timestamps has been added yet)
+   */
+  tTime Transform(const tTime& source_time) const
+  {
+    long long source = source_time.ToNSec();
+    return tTime().FromNSec(source + offset + static_cast<long long>(skew * static_cast<double>(source - reference)));
+  }
+
+  /*!
+   * Transforms array of timestamps
+   *
+   * \param source_times Times in source time base
+   * \param target_times Array to write times in target time base to (may be the same as source_times)
+   * \param count Number of times
+   */
+  void Transform(const tTime* source_times, tTime* target_times, size_t count) const;
+
+  /*!
+   * Transforms array of timestamps in place
+   */
+  void Transform(std::vector<tTime>& times) const
+  {
+    Transform(times.data(), times.data(), times.size());
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Pair of timestamps (nanoseconds) */
+  struct tSample
+  {
+    long long source, target;
+  };
+
+  /*! Ring buffer with the last pairs of timestamps */
+  std::vector<tSample> samples;
+
+  /*! Index of oldest pair in ring buffer and number of pairs */
+  size_t oldest_sample, sample_count;
+
+  /*! Estimated relation: target = source + offset + skew * (source - reference) (nanoseconds) */
+  long long reference, offset;
+  double skew;
+
+
+  /*! Estimates offset and skew from pairs in ring buffer */
+  void Estimate();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
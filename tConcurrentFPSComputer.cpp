@@ -0,0 +1,173 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tConcurrentFPSComputer.cpp
+ *
+ * \author  Bernd Helge Schaefer
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tConcurrentFPSComputer.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Maximum number of shards */
+const unsigned int cMAX_SHARDS = 256;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+unsigned int NextConcurrentCounterThreadIndex()
+{
+  static std::atomic<unsigned int> next_index(0);
+  return next_index.fetch_add(1, std::memory_order_relaxed);
+}
+
+}
+
+//----------------------------------------------------------------------
+// tConcurrentFPSComputer constructors
+//----------------------------------------------------------------------
+tConcurrentFPSComputer::tConcurrentFPSComputer(long long int check_interval_ms, float old_value_weight) :
+  fps_computer(check_interval_ms, old_value_weight),
+  aggregated_frame_counter(0),
+  fps(0)
+{
+  CreateShards();
+}
+
+tConcurrentFPSComputer::tConcurrentFPSComputer(const util::tTime &current_time, long long int check_interval_ms, float old_value_weight) :
+  fps_computer(current_time, check_interval_ms, old_value_weight),
+  aggregated_frame_counter(0),
+  fps(0)
+{
+  CreateShards();
+}
+
+//----------------------------------------------------------------------
+// tConcurrentFPSComputer CheckFPS
+//----------------------------------------------------------------------
+bool tConcurrentFPSComputer::CheckFPS(const util::tTime &current_time)
+{
+  uint64_t frame_counter = FrameCounter();
+  std::lock_guard<std::mutex> lock(mutex);
+  if (frame_counter > aggregated_frame_counter)
+  {
+    uint64_t new_frames = frame_counter - aggregated_frame_counter;
+    while (new_frames > 0)
+    {
+      unsigned int increment = static_cast<unsigned int>(std::min<uint64_t>(new_frames, std::numeric_limits<unsigned int>::max()));
+      fps_computer.IncrementFrameCounter(increment);
+      new_frames -= increment;
+    }
+    aggregated_frame_counter = frame_counter;
+  }
+  bool updated = fps_computer.CheckFPS(current_time);
+  fps.store(fps_computer.FPS(), std::memory_order_relaxed);
+  return updated;
+}
+
+//----------------------------------------------------------------------
+// tConcurrentFPSComputer CreateShards
+//----------------------------------------------------------------------
+void tConcurrentFPSComputer::CreateShards()
+{
+  unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+  unsigned int shard_count = 1;
+  while (shard_count < cores && shard_count < cMAX_SHARDS)
+  {
+    shard_count *= 2;
+  }
+  shards.reset(new tShard[shard_count]);
+  for (unsigned int i = 0; i < shard_count; i++)
+  {
+    shards[i].counter.store(0, std::memory_order_relaxed);
+  }
+  shard_mask = shard_count - 1;
+}
+
+//----------------------------------------------------------------------
+// tConcurrentFPSComputer FrameCounter
+//----------------------------------------------------------------------
+uint64_t tConcurrentFPSComputer::FrameCounter() const
+{
+  uint64_t sum = 0;
+  for (unsigned int i = 0; i <= shard_mask; i++)
+  {
+    sum += shards[i].counter.load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
+//----------------------------------------------------------------------
+// tConcurrentFPSComputer SetCheckInterval
+//----------------------------------------------------------------------
+void tConcurrentFPSComputer::SetCheckInterval(long long int new_check_interval_ms)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  fps_computer.SetCheckInterval(new_check_interval_ms);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
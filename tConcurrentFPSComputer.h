@@ -0,0 +1,194 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tConcurrentFPSComputer.h
+ *
+ * \author  Bernd Helge Schaefer
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tConcurrentFPSComputer
+ *
+ * \b tConcurrentFPSComputer
+ *
+ * Thread-safe variant of tFPSComputer: frames (or any other events) may
+ * be counted by many threads concurrently - without locking.
+ *
+ * Incrementing a single shared atomic counter from many threads at high
+ * rates is slow, as the cache line of the counter bounces between cores.
+ * Therefore, counts are distributed over several counters ("shards") in
+ * separate cache lines - one per core. Every thread is assigned to one
+ * shard. CheckFPS() adds up all shards.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tConcurrentFPSComputer_h__
+#define __rrlib__util__tConcurrentFPSComputer_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tFPSComputer.h"
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+/*! \return Next thread index (threads are distributed round-robin over shards) */
+unsigned int NextConcurrentCounterThreadIndex();
+
+/*! \return Index of shard for the current thread (assigned on first call) */
+inline unsigned int GetConcurrentCounterThreadIndex()
+{
+  thread_local unsigned int index = NextConcurrentCounterThreadIndex();
+  return index;
+}
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Thread-safe frame rate computer
+/*!
+ * Computes frame rate (or any other event rate) like tFPSComputer.
+ * IncrementFrameCounter() may be called by any number of threads
+ * concurrently (lock-free; a single relaxed atomic addition on a counter
+ * that is typically not shared with other threads).
+ * CheckFPS() and FPS() may be called by any thread as well.
+ */
+class tConcurrentFPSComputer : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param check_interval_ms Minimum interval between FPS updates (in ms)
+   * \param old_value_weight Weight of old value when updating FPS (exponential smoothing)
+   */
+  tConcurrentFPSComputer(long long int check_interval_ms = 1000, float old_value_weight = 0.75);
+
+  tConcurrentFPSComputer(const util::tTime &current_time, long long int check_interval_ms = 1000, float old_value_weight = 0.75);
+
+  inline void IncrementFrameCounter(unsigned int num_frames = 1)
+  {
+    shards[internal::GetConcurrentCounterThreadIndex() & shard_mask].counter.fetch_add(num_frames, std::memory_order_relaxed);
+  }
+
+  inline bool IncrementFrameCounterAndCheckFPS()
+  {
+    return IncrementFrameCounterAndCheckFPS(util::tTime::Now());
+  }
+
+  inline bool IncrementFrameCounterAndCheckFPS(const util::tTime &current_time)
+  {
+    IncrementFrameCounter();
+    return CheckFPS(current_time);
+  }
+
+  inline bool CheckFPS()
+  {
+    return CheckFPS(util::tTime::Now());
+  }
+
+  /*!
+   * Adds up counters of all threads and updates FPS if check interval has passed
+   *
+   * \param current_time Current time
+   * \return True if FPS was updated
+   */
+  bool CheckFPS(const util::tTime &current_time);
+
+  inline float FPS() const
+  {
+    return fps.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \return Total number of frames counted by all threads
+   */
+  uint64_t FrameCounter() const;
+
+  void SetCheckInterval(long long int new_check_interval_ms);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Counter in its own cache line */
+  struct alignas(64) tShard
+  {
+    std::atomic<uint64_t> counter;
+  };
+
+  /*! Counters (number is a power of two) */
+  std::unique_ptr<tShard[]> shards;
+
+  /*! Number of shards minus one */
+  unsigned int shard_mask;
+
+  /*! Computes FPS from aggregated counter (protected by mutex) */
+  tFPSComputer fps_computer;
+
+  /*! Frame count that fps_computer has been updated with (protected by mutex) */
+  uint64_t aggregated_frame_counter;
+
+  /*! Mutex for aggregation */
+  std::mutex mutex;
+
+  /*! Current FPS */
+  std::atomic<float> fps;
+
+
+  /*! Allocates shards */
+  void CreateShards();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -27,11 +27,16 @@
  *
  * \brief   Contains class tFPSComputer
  *
+ * For frame time distributions (percentiles, jitter, min/max), see
+ * tFrameTimeMonitor.
+ *
  */
 //----------------------------------------------------------------------
 #ifndef _util_tFPSComputer_h_
 #define _util_tFPSComputer_h_
 
+#include <cstdint>
+
 #include "rrlib/util/tTime.h"
 
 namespace rrlib
@@ -77,7 +82,7 @@ public:
     }
     else if (ms_passed > this->check_interval_ms)
     {
-      double number_of_frames = this->frame_counter - this->last_frame_counter;
+      double number_of_frames = static_cast<double>(this->frame_counter - this->last_frame_counter);
 
       fps = this->old_value_weight * fps + (1. - this->old_value_weight) * (number_of_frames * (1000. / (double) ms_passed));
 
@@ -100,7 +105,7 @@ public:
 
   inline double FrameCounter() const
   {
-    return this->frame_counter;
+    return static_cast<double>(this->frame_counter);
   }
 
   void SetCheckInterval(long long int new_check_interval_ms)
@@ -111,10 +116,8 @@ public:
 private:
   util::tTime current_fps_check;
   util::tTime last_fps_check;
-  util::tTime time_diff_check;
-  double last_frame_counter;
-  double frame_counter;
-  double time_diff;
+  uint64_t last_frame_counter;
+  uint64_t frame_counter;
   float fps;
   float old_value_weight;
   long long int check_interval_ms;
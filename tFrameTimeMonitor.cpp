@@ -0,0 +1,131 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tFrameTimeMonitor.cpp
+ *
+ * \author  Bernd Helge Schaefer
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tFrameTimeMonitor.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tFrameTimeMonitor constructors
+//----------------------------------------------------------------------
+tFrameTimeMonitor::tFrameTimeMonitor(const tTime& window, tClockSource clock_source) :
+  window(window),
+  clock_source(clock_source),
+  frame_counter(0),
+  statistics()
+{
+  Reset();
+}
+
+//----------------------------------------------------------------------
+// tFrameTimeMonitor CompleteWindow
+//----------------------------------------------------------------------
+void tFrameTimeMonitor::CompleteWindow(const tTime& current_time)
+{
+  uint64_t frames = histogram.Count();
+  statistics.frames = frames;
+  statistics.window = current_time - window_start;
+  long long window_nsec = statistics.window.ToNSec();
+  statistics.frame_rate = window_nsec > 0 ? frames * 1000000000.0 / window_nsec : 0.0;
+  if (frames)
+  {
+    double mean = frame_time_sum / frames;
+    double variance = std::max(0.0, frame_time_square_sum / frames - mean * mean);
+    statistics.min_frame_time.FromNSec(histogram.Min());
+    statistics.max_frame_time.FromNSec(histogram.Max());
+    statistics.mean_frame_time.FromNSec(std::llround(mean));
+    statistics.p50_frame_time.FromNSec(histogram.Percentile(50));
+    statistics.p90_frame_time.FromNSec(histogram.Percentile(90));
+    statistics.p99_frame_time.FromNSec(histogram.Percentile(99));
+    statistics.jitter.FromNSec(std::llround(std::sqrt(variance)));
+  }
+  else
+  {
+    statistics.min_frame_time = statistics.max_frame_time = statistics.mean_frame_time = tTime();
+    statistics.p50_frame_time = statistics.p90_frame_time = statistics.p99_frame_time = statistics.jitter = tTime();
+  }
+
+  histogram.Clear();
+  frame_time_sum = frame_time_square_sum = 0;
+  window_start = current_time;
+}
+
+//----------------------------------------------------------------------
+// tFrameTimeMonitor Reset
+//----------------------------------------------------------------------
+void tFrameTimeMonitor::Reset()
+{
+  window_start = last_frame = tTime();
+  has_last_frame = false;
+  histogram.Clear();
+  frame_time_sum = frame_time_square_sum = 0;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,230 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tFrameTimeMonitor.h
+ *
+ * \author  Bernd Helge Schaefer
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tFrameTimeMonitor
+ *
+ * \b tFrameTimeMonitor
+ *
+ * Monitors the frame rate and the distribution of frame times (intervals
+ * between consecutive frames) of e.g. sensor data or control loops.
+ *
+ * While tFPSComputer only provides an exponentially weighted average of
+ * the frame rate, this class provides statistics for time windows
+ * (e.g. every second): frame rate, min/max/mean frame time, percentiles
+ * (p50, p90, p99) and jitter.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tFrameTimeMonitor_h__
+#define __rrlib__util__tFrameTimeMonitor_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tLogLinearHistogram.h"
+#include "rrlib/util/tTime.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Frame statistics of one time window */
+struct tFrameTimeStatistics
+{
+  /*! Number of frame intervals in window */
+  uint64_t frames;
+
+  /*! Duration of window */
+  tTime window;
+
+  /*! Frames per second in window */
+  double frame_rate;
+
+  /*! Minimum, maximum and mean frame time */
+  tTime min_frame_time, max_frame_time, mean_frame_time;
+
+  /*! Frame time percentiles (relative error at most 1/16) */
+  tTime p50_frame_time, p90_frame_time, p99_frame_time;
+
+  /*! Jitter: standard deviation of frame time */
+  tTime jitter;
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Frame rate and frame time monitor
+/*!
+ * Records the interval between consecutive frames in a tLogLinearHistogram.
+ * Whenever a time window has passed, statistics are computed and the
+ * histogram is cleared.
+ *
+ * Frame() is O(1) and never allocates memory (computing the statistics
+ * at the end of a window iterates over the histogram once).
+ *
+ * Objects are not thread-safe.
+ */
+class tFrameTimeMonitor
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param window Length of time windows that statistics are computed for
+   * \param clock_source Clock that Frame() without arguments reads
+   */
+  explicit tFrameTimeMonitor(const tTime& window = tTime::time_1s, tClockSource clock_source = tClockSource::MONOTONIC);
+
+  /*!
+   * Records frame at current time
+   *
+   * \return True if a time window was completed (new statistics are available)
+   */
+  bool Frame()
+  {
+    return Frame(tTime::Now(clock_source));
+  }
+
+  /*!
+   * Records frame
+   *
+   * \param current_time Time of frame
+   * \return True if a time window was completed (new statistics are available)
+   */
+  bool Frame(const tTime& current_time)
+  {
+    frame_counter++;
+    if (has_last_frame)
+    {
+      long long frame_time = (current_time - last_frame).ToNSec();
+      frame_time = frame_time > 0 ? frame_time : 0;
+      histogram.Add(static_cast<uint64_t>(frame_time));
+      frame_time_sum += static_cast<double>(frame_time);
+      frame_time_square_sum += static_cast<double>(frame_time) * static_cast<double>(frame_time);
+    }
+    else
+    {
+      window_start = current_time;
+      has_last_frame = true;
+    }
+    last_frame = current_time;
+    if (current_time - window_start >= window)
+    {
+      CompleteWindow(current_time);
+      return true;
+    }
+    return false;
+  }
+
+  /*!
+   * \return Total number of frames recorded
+   */
+  uint64_t FrameCounter() const
+  {
+    return frame_counter;
+  }
+
+  /*!
+   * \return Histogram of frame times (nanoseconds) in the current (incomplete) window
+   */
+  const tLogLinearHistogram& GetCurrentHistogram() const
+  {
+    return histogram;
+  }
+
+  /*!
+   * \return Statistics of the last completed time window (zero if no window has been completed yet)
+   */
+  const tFrameTimeStatistics& GetStatistics() const
+  {
+    return statistics;
+  }
+
+  /*!
+   * Discards frames of the current window and forgets the last frame
+   * (e.g. after recording was paused)
+   */
+  void Reset();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Length of time windows */
+  tTime window;
+
+  /*! Clock that Frame() reads */
+  tClockSource clock_source;
+
+  /*! Start of current window and time of last frame */
+  tTime window_start, last_frame;
+
+  /*! Whether a frame has been recorded since construction or Reset() */
+  bool has_last_frame;
+
+  /*! Total number of frames */
+  uint64_t frame_counter;
+
+  /*! Frame times in current window (nanoseconds) */
+  tLogLinearHistogram histogram;
+
+  /*! Sum of frame times and squared frame times in current window (nanoseconds) */
+  double frame_time_sum, frame_time_square_sum;
+
+  /*! Statistics of last completed window */
+  tFrameTimeStatistics statistics;
+
+
+  /*! Computes statistics for current window and starts next window */
+  void CompleteWindow(const tTime& current_time);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
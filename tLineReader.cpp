@@ -0,0 +1,201 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tLineReader.cpp
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tLineReader.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+
+extern "C"
+{
+#include <fcntl.h>
+#include <unistd.h>
+}
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tLineReader::cDEFAULT_BUFFER_SIZE;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tLineReader constructors
+//----------------------------------------------------------------------
+tLineReader::tLineReader(int file_descriptor, char delimiter, size_t buffer_size) :
+  file_descriptor(file_descriptor),
+  close_file_descriptor(false),
+  delimiter(delimiter),
+  buffer(std::max<size_t>(buffer_size, 16)),
+  data_begin(0),
+  data_end(0),
+  search_position(0),
+  end_of_file(false),
+  line_number(0)
+{}
+
+tLineReader::tLineReader(const std::string& file_name, char delimiter, size_t buffer_size) :
+  tLineReader(open(file_name.c_str(), O_RDONLY | O_CLOEXEC), delimiter, buffer_size)
+{
+  if (file_descriptor < 0)
+  {
+    throw std::runtime_error("Could not open file <" + file_name + ">: " + strerror(errno));
+  }
+  close_file_descriptor = true;
+  posix_fadvise(file_descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+}
+
+//----------------------------------------------------------------------
+// tLineReader destructor
+//----------------------------------------------------------------------
+tLineReader::~tLineReader()
+{
+  if (close_file_descriptor)
+  {
+    close(file_descriptor);
+  }
+}
+
+//----------------------------------------------------------------------
+// tLineReader FillBuffer
+//----------------------------------------------------------------------
+void tLineReader::FillBuffer()
+{
+  if (data_begin > 0)
+  {
+    memmove(buffer.data(), buffer.data() + data_begin, data_end - data_begin);
+    data_end -= data_begin;
+    search_position -= data_begin;
+    data_begin = 0;
+  }
+  if (data_end == buffer.size())
+  {
+    buffer.resize(buffer.size() * 2);
+  }
+
+  ssize_t bytes_read;
+  do
+  {
+    bytes_read = read(file_descriptor, buffer.data() + data_end, buffer.size() - data_end);
+  }
+  while (bytes_read < 0 && errno == EINTR);
+
+  if (bytes_read < 0)
+  {
+    throw std::runtime_error(std::string("Error reading lines: ") + strerror(errno));
+  }
+  if (bytes_read == 0)
+  {
+    end_of_file = true;
+  }
+  data_end += bytes_read;
+}
+
+//----------------------------------------------------------------------
+// tLineReader ReadLine
+//----------------------------------------------------------------------
+bool tLineReader::ReadLine(std::string_view& line)
+{
+  while (true)
+  {
+    const char* found = static_cast<const char*>(memchr(buffer.data() + search_position, delimiter, data_end - search_position));
+    if (found)
+    {
+      ReturnLine(line, found - buffer.data());
+      data_begin++;  // skip delimiter
+      search_position = data_begin;
+      return true;
+    }
+    search_position = data_end;
+
+    if (end_of_file)
+    {
+      if (data_begin == data_end)
+      {
+        return false;
+      }
+      ReturnLine(line, data_end);
+      return true;
+    }
+    FillBuffer();
+  }
+}
+
+//----------------------------------------------------------------------
+// tLineReader ReturnLine
+//----------------------------------------------------------------------
+void tLineReader::ReturnLine(std::string_view& line, size_t end)
+{
+  size_t line_end = end;
+  if (delimiter == '\n' && line_end > data_begin && buffer[line_end - 1] == '\r')
+  {
+    line_end--;
+  }
+  line = std::string_view(buffer.data() + data_begin, line_end - data_begin);
+  data_begin = end;
+  line_number++;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,196 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tLineReader.h
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tLineReader
+ *
+ * \b tLineReader
+ *
+ * Reads a file (or any other file descriptor) line by line.
+ *
+ * Data is read in large blocks into a buffer that is reused for the
+ * whole file. Lines are returned as std::string_view pointing into this
+ * buffer - so no allocations or copies are required per line. This makes
+ * it a replacement for sStringUtils::getline and std::getline when
+ * processing large files (e.g. log files).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tLineReader_h__
+#define __rrlib__util__tLineReader_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+#include <string_view>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Buffered line reader
+/*!
+ * Reads a file (or any other file descriptor) line by line.
+ *
+ * Lines are returned as std::string_view that points into an internal
+ * buffer. A line is only valid until the next call to ReadLine().
+ * Lines do not include the delimiter. If the delimiter is '\n', a
+ * trailing '\r' is removed as well (so files with Windows line endings
+ * are handled). The last line need not be terminated by a delimiter.
+ *
+ * Lines longer than the buffer size are supported (the buffer grows).
+ *
+ * Usage:
+ *
+ *   tLineReader reader("log.txt");
+ *   std::string_view line;
+ *   while (reader.ReadLine(line))
+ *   {
+ *     ...
+ *   }
+ */
+class tLineReader : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Default size of read buffer */
+  static const size_t cDEFAULT_BUFFER_SIZE = 256 * 1024;
+
+  /*!
+   * Reads from an open file descriptor (the reader does not close it)
+   *
+   * \param file_descriptor File descriptor to read from
+   * \param delimiter Character that separates lines
+   * \param buffer_size Initial size of read buffer
+   */
+  tLineReader(int file_descriptor, char delimiter = '\n', size_t buffer_size = cDEFAULT_BUFFER_SIZE);
+
+  /*!
+   * Opens and reads the specified file (which is closed on destruction)
+   *
+   * \param file_name Name of file to read
+   * \param delimiter Character that separates lines
+   * \param buffer_size Initial size of read buffer
+   * \throws runtime_error if file cannot be opened
+   */
+  tLineReader(const std::string& file_name, char delimiter = '\n', size_t buffer_size = cDEFAULT_BUFFER_SIZE);
+
+  ~tLineReader();
+
+  /*!
+   * \return Number of lines returned by ReadLine() so far
+   */
+  size_t LineNumber() const
+  {
+    return line_number;
+  }
+
+  /*!
+   * Reads next line
+   *
+   * \param line Contains next line after call (valid until next call of ReadLine())
+   * \return False if there are no more lines (end of file)
+   * \throws runtime_error if reading from file descriptor fails
+   */
+  bool ReadLine(std::string_view& line);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! File descriptor to read from */
+  int file_descriptor;
+
+  /*! Whether file descriptor is closed on destruction */
+  bool close_file_descriptor;
+
+  /*! Character that separates lines */
+  char delimiter;
+
+  /*! Read buffer */
+  std::vector<char> buffer;
+
+  /*! Start of the unread data in buffer */
+  size_t data_begin;
+
+  /*! End of the valid data in buffer */
+  size_t data_end;
+
+  /*! Position up to which unread data has been searched for a delimiter */
+  size_t search_position;
+
+  /*! Whether end of file has been reached */
+  bool end_of_file;
+
+  /*! Number of lines returned */
+  size_t line_number;
+
+
+  /*!
+   * Moves unread data to the front of the buffer (growing it if it is full) and reads more data
+   */
+  void FillBuffer();
+
+  /*!
+   * Returns line from data_begin to 'end' and marks it as read
+   *
+   * \param line Is set to line
+   * \param end End of line (position of delimiter or data_end)
+   */
+  void ReturnLine(std::string_view& line, size_t end);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,268 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tLogLinearHistogram.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tLogLinearHistogram
+ *
+ * \b tLogLinearHistogram
+ *
+ * Fixed-size histogram of non-negative integer values (e.g. durations in
+ * nanoseconds) with bounded relative error.
+ *
+ * Buckets are log-linear: every power of two is divided into 16 linear
+ * sub-buckets. So the relative error of values obtained from the
+ * histogram (e.g. percentiles) is at most 1/16 - for values from 0 to
+ * 2^48 - with a fixed memory footprint. Adding a value is O(1) and never
+ * allocates memory.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tLogLinearHistogram_h__
+#define __rrlib__util__tLogLinearHistogram_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Log-linear histogram
+/*!
+ * Fixed-size histogram with log-linear buckets (see file description).
+ * Values above the range of the histogram (2^48) are counted in the last
+ * bucket. Minimum and maximum are tracked exactly.
+ */
+class tLogLinearHistogram
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Number of bits for linear sub-buckets (2^cSUB_BUCKET_BITS sub-buckets per power of two) */
+  static constexpr unsigned int cSUB_BUCKET_BITS = 4;
+  static constexpr uint64_t cSUB_BUCKETS = 1 << cSUB_BUCKET_BITS;
+
+  /*! Values up to 2^(cMAX_EXPONENT + 1) - 1 are represented with bounded error */
+  static constexpr unsigned int cMAX_EXPONENT = 47;
+
+  /*! Number of buckets */
+  static constexpr size_t cBUCKETS = (cMAX_EXPONENT - cSUB_BUCKET_BITS + 2) * cSUB_BUCKETS;
+
+  tLogLinearHistogram()
+  {
+    Clear();
+  }
+
+  /*!
+   * Adds value to histogram
+   *
+   * \param value Value to add
+   * \param count Number of times to add value
+   */
+  void Add(uint64_t value, uint64_t count = 1)
+  {
+    counts[BucketIndex(value)] += count;
+    total_count += count;
+    min = value < min ? value : min;
+    max = value > max ? value : max;
+  }
+
+  /*!
+   * Adds all values of another histogram
+   */
+  void Add(const tLogLinearHistogram& other)
+  {
+    for (size_t i = 0; i < cBUCKETS; i++)
+    {
+      counts[i] += other.counts[i];
+    }
+    total_count += other.total_count;
+    min = other.min < min ? other.min : min;
+    max = other.max > max ? other.max : max;
+  }
+
+  /*!
+   * \param value Value
+   * \return Index of bucket that value is counted in
+   */
+  static constexpr size_t BucketIndex(uint64_t value)
+  {
+    if (value < cSUB_BUCKETS)
+    {
+      return static_cast<size_t>(value);
+    }
+    unsigned int exponent = 63 - __builtin_clzll(value);
+    if (exponent > cMAX_EXPONENT)
+    {
+      return cBUCKETS - 1;
+    }
+    unsigned int shift = exponent - cSUB_BUCKET_BITS;
+    return (shift + 1) * cSUB_BUCKETS + static_cast<size_t>((value >> shift) - cSUB_BUCKETS);
+  }
+
+  /*!
+   * \param index Index of bucket
+   * \return Smallest value counted in bucket
+   */
+  static constexpr uint64_t BucketLowerBound(size_t index)
+  {
+    if (index < cSUB_BUCKETS)
+    {
+      return index;
+    }
+    unsigned int shift = static_cast<unsigned int>(index / cSUB_BUCKETS - 1);
+    return (cSUB_BUCKETS + index % cSUB_BUCKETS) << shift;
+  }
+
+  /*!
+   * \param index Index of bucket
+   * \return Largest value counted in bucket
+   */
+  static constexpr uint64_t BucketUpperBound(size_t index)
+  {
+    return index + 1 < cBUCKETS ? BucketLowerBound(index + 1) - 1 : std::numeric_limits<uint64_t>::max();
+  }
+
+  /*!
+   * Removes all values
+   */
+  void Clear()
+  {
+    counts.fill(0);
+    total_count = 0;
+    min = std::numeric_limits<uint64_t>::max();
+    max = 0;
+  }
+
+  /*!
+   * \return Number of values in histogram
+   */
+  uint64_t Count() const
+  {
+    return total_count;
+  }
+
+  /*!
+   * \param index Index of bucket
+   * \return Number of values in bucket
+   */
+  uint64_t GetBucketCount(size_t index) const
+  {
+    return counts[index];
+  }
+
+  /*!
+   * \return Largest value (0 if histogram is empty)
+   */
+  uint64_t Max() const
+  {
+    return max;
+  }
+
+  /*!
+   * \return Smallest value (0 if histogram is empty)
+   */
+  uint64_t Min() const
+  {
+    return total_count ? min : 0;
+  }
+
+  /*!
+   * \param percentile Percentile (0 to 100 - e.g. 50 for the median)
+   * \return Value at percentile (middle of bucket - clamped to [Min(), Max()]; Max() for 100; 0 if histogram is empty)
+   */
+  uint64_t Percentile(double percentile) const
+  {
+    if (total_count == 0)
+    {
+      return 0;
+    }
+    double rank_double = percentile / 100.0 * total_count;
+    uint64_t rank = rank_double < 1.0 ? 1 : static_cast<uint64_t>(rank_double + 0.999999);
+    if (rank >= total_count)
+    {
+      return max;
+    }
+    uint64_t cumulated = 0;
+    for (size_t i = 0; i < cBUCKETS; i++)
+    {
+      cumulated += counts[i];
+      if (cumulated >= rank)
+      {
+        uint64_t lower = BucketLowerBound(i);
+        uint64_t value = lower + (BucketUpperBound(i) - lower) / 2;
+        return value < min ? min : (value > max ? max : value);
+      }
+    }
+    return max;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Number of values in every bucket */
+  std::array<uint64_t, cBUCKETS> counts;
+
+  /*! Number of values in histogram */
+  uint64_t total_count;
+
+  /*! Smallest and largest value */
+  uint64_t min, max;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
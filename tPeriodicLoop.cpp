@@ -0,0 +1,198 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tPeriodicLoop.cpp
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tPeriodicLoop.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+
+extern "C"
+{
+#include <time.h>
+}
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tPeriodicLoop constructors
+//----------------------------------------------------------------------
+tPeriodicLoop::tPeriodicLoop(const tTime& period, tOverrunPolicy overrun_policy, const tTime& busy_wait_time) :
+  period(period),
+  overrun_policy(overrun_policy),
+  busy_wait_time(busy_wait_time)
+{
+  assert(period > tTime::time_0ms);
+  ResetStatistics();
+  Restart();
+}
+
+//----------------------------------------------------------------------
+// tPeriodicLoop GetStatistics
+//----------------------------------------------------------------------
+tPeriodicLoopStatistics tPeriodicLoop::GetStatistics() const
+{
+  tPeriodicLoopStatistics statistics;
+  statistics.cycles = cycles;
+  statistics.overruns = overruns;
+  statistics.skipped_cycles = skipped_cycles;
+  if (waited_cycles)
+  {
+    double mean = latency_sum / waited_cycles;
+    double variance = std::max(0.0, latency_square_sum / waited_cycles - mean * mean);
+    statistics.min_latency.FromNSec(min_latency);
+    statistics.max_latency.FromNSec(max_latency);
+    statistics.mean_latency.FromNSec(std::llround(mean));
+    statistics.latency_standard_deviation.FromNSec(std::llround(std::sqrt(variance)));
+  }
+  statistics.max_execution_time.FromNSec(max_execution_time);
+  statistics.mean_execution_time.FromNSec(execution_time_samples ? std::llround(execution_time_sum / execution_time_samples) : 0);
+  return statistics;
+}
+
+//----------------------------------------------------------------------
+// tPeriodicLoop ResetStatistics
+//----------------------------------------------------------------------
+void tPeriodicLoop::ResetStatistics()
+{
+  cycles = overruns = skipped_cycles = waited_cycles = execution_time_samples = 0;
+  min_latency = max_latency = max_execution_time = 0;
+  latency_sum = latency_square_sum = execution_time_sum = 0;
+}
+
+//----------------------------------------------------------------------
+// tPeriodicLoop Restart
+//----------------------------------------------------------------------
+void tPeriodicLoop::Restart()
+{
+  deadline = tTime::Now(tClockSource::MONOTONIC);
+  cycle_start = tTime();
+}
+
+//----------------------------------------------------------------------
+// tPeriodicLoop WaitForNextCycle
+//----------------------------------------------------------------------
+uint64_t tPeriodicLoop::WaitForNextCycle()
+{
+  tTime now = tTime::Now(tClockSource::MONOTONIC);
+  if (!cycle_start.IsZero())
+  {
+    long long execution_time = (now - cycle_start).ToNSec();
+    max_execution_time = std::max(max_execution_time, execution_time);
+    execution_time_sum += execution_time;
+    execution_time_samples++;
+  }
+
+  deadline += period;
+  uint64_t skipped = 0;
+  if (now >= deadline)
+  {
+    overruns++;
+    if (overrun_policy == tOverrunPolicy::SKIP)
+    {
+      skipped = static_cast<uint64_t>((now - deadline).ToNSec() / period.ToNSec()) + 1;
+      deadline += period * skipped;
+      skipped_cycles += skipped;
+    }
+    else
+    {
+      // catch up: start cycle immediately
+      cycles++;
+      cycle_start = now;
+      return 0;
+    }
+  }
+
+  cycle_start = WaitUntil(deadline);
+  cycles++;
+  waited_cycles++;
+  long long latency = (cycle_start - deadline).ToNSec();
+  min_latency = (waited_cycles == 1) ? latency : std::min(min_latency, latency);
+  max_latency = std::max(max_latency, latency);
+  latency_sum += latency;
+  latency_square_sum += static_cast<double>(latency) * latency;
+  return skipped;
+}
+
+//----------------------------------------------------------------------
+// tPeriodicLoop WaitUntil
+//----------------------------------------------------------------------
+tTime tPeriodicLoop::WaitUntil(const tTime& time)
+{
+  timespec wake_up = time - busy_wait_time;
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake_up, nullptr) == EINTR)
+  {}
+
+  tTime now = tTime::Now(tClockSource::MONOTONIC);
+  while (now < time)
+  {
+    now = tTime::Now(tClockSource::MONOTONIC);
+  }
+  return now;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,230 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tPeriodicLoop.h
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tPeriodicLoop
+ *
+ * \b tPeriodicLoop
+ *
+ * Executes cycles of a loop with a fixed period (e.g. every 10 ms).
+ *
+ * Deadlines are absolute times on CLOCK_MONOTONIC (deadline n is
+ * start + n * period). Threads sleep until the next deadline with
+ * clock_nanosleep(TIMER_ABSTIME) - so, unlike sleeping for relative
+ * durations, errors do not accumulate (no drift). Optionally, the last
+ * part of the waiting time is spent busy-waiting in order to reduce
+ * wake-up latency.
+ *
+ * Usage:
+ *
+ *   tPeriodicLoop loop(tTime::time_10ms);
+ *   while (running)
+ *   {
+ *     loop.WaitForNextCycle();
+ *     ...
+ *   }
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tPeriodicLoop_h__
+#define __rrlib__util__tPeriodicLoop_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tTime.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! What tPeriodicLoop does if a cycle takes longer than the period */
+enum class tOverrunPolicy
+{
+  SKIP,     //!< Skip cycles whose deadline has passed and continue with the next deadline in the future (keeps phase)
+  CATCH_UP  //!< Start missed cycles immediately (without sleeping) until the loop is back on schedule
+};
+
+/*! Statistics collected by tPeriodicLoop */
+struct tPeriodicLoopStatistics
+{
+  /*! Number of cycles started */
+  uint64_t cycles;
+
+  /*! Number of cycles whose deadline had already passed when the previous cycle ended */
+  uint64_t overruns;
+
+  /*! Number of cycles skipped (tOverrunPolicy::SKIP) */
+  uint64_t skipped_cycles;
+
+  /*! Wake-up latency (actual start of cycle minus deadline) of cycles that were waited for */
+  tTime min_latency, max_latency, mean_latency;
+
+  /*! Standard deviation of wake-up latency (jitter) */
+  tTime latency_standard_deviation;
+
+  /*! Execution time of cycles (from start of cycle until WaitForNextCycle() is called again) */
+  tTime max_execution_time, mean_execution_time;
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Scheduler for periodic loops
+/*!
+ * Executes cycles of a loop with a fixed period.
+ * Deadlines are absolute CLOCK_MONOTONIC times (see tClockSource::MONOTONIC)
+ * - so there is no drift.
+ *
+ * An object is used by a single thread.
+ */
+class tPeriodicLoop
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param period Period of loop
+   * \param overrun_policy What to do if a cycle takes longer than the period
+   * \param busy_wait_time Time before each deadline that is spent busy-waiting instead of sleeping
+   *                       (reduces wake-up latency at the cost of CPU time - zero disables busy-waiting)
+   */
+  explicit tPeriodicLoop(const tTime& period, tOverrunPolicy overrun_policy = tOverrunPolicy::SKIP, const tTime& busy_wait_time = tTime());
+
+  /*!
+   * \return Deadline (planned start) of the current cycle (CLOCK_MONOTONIC time)
+   */
+  const tTime& GetDeadline() const
+  {
+    return deadline;
+  }
+
+  /*!
+   * \return Period of loop
+   */
+  const tTime& GetPeriod() const
+  {
+    return period;
+  }
+
+  /*!
+   * \return Statistics since construction or the last call of ResetStatistics()
+   */
+  tPeriodicLoopStatistics GetStatistics() const;
+
+  /*!
+   * Resets statistics
+   */
+  void ResetStatistics();
+
+  /*!
+   * Restarts loop: the deadline of the next cycle is one period from now
+   * (e.g. after the loop has been paused)
+   */
+  void Restart();
+
+  /*!
+   * Runs loop until function returns false
+   *
+   * \param function Function to call in every cycle (signature: bool())
+   */
+  template <typename TFunction>
+  void Run(TFunction function)
+  {
+    do
+    {
+      WaitForNextCycle();
+    }
+    while (function());
+  }
+
+  /*!
+   * Waits until the deadline of the next cycle
+   * (the first call waits until one period after construction)
+   *
+   * \return Number of cycles skipped (always zero - unless the previous cycle overran with tOverrunPolicy::SKIP)
+   */
+  uint64_t WaitForNextCycle();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Period of loop */
+  tTime period;
+
+  /*! What to do if a cycle takes longer than the period */
+  tOverrunPolicy overrun_policy;
+
+  /*! Time before each deadline that is spent busy-waiting */
+  tTime busy_wait_time;
+
+  /*! Deadline of the current cycle */
+  tTime deadline;
+
+  /*! Actual start of the current cycle */
+  tTime cycle_start;
+
+  /*! Counters for statistics */
+  uint64_t cycles, overruns, skipped_cycles, waited_cycles, execution_time_samples;
+
+  /*! Accumulated latencies and execution times for statistics (nanoseconds) */
+  long long min_latency, max_latency, max_execution_time;
+  double latency_sum, latency_square_sum, execution_time_sum;
+
+  /*!
+   * Waits until the specified CLOCK_MONOTONIC time
+   *
+   * \return Time when waiting ended
+   */
+  tTime WaitUntil(const tTime& time);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
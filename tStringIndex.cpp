@@ -0,0 +1,152 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tStringIndex.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tStringIndex.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tStringIndex constructors
+//----------------------------------------------------------------------
+tStringIndex::tStringIndex(const char* const* strings, size_t number_of_strings) :
+  mask(0)
+{
+  assert(strings || number_of_strings == 0);
+  this->strings.reserve(number_of_strings);
+  for (size_t i = 0; i < number_of_strings; i++)
+  {
+    assert(strings[i]);
+    this->strings.emplace_back(strings[i]);
+  }
+  Build();
+}
+
+tStringIndex::tStringIndex(const std::vector<std::string>& strings) :
+  strings(strings),
+  mask(0)
+{
+  Build();
+}
+
+//----------------------------------------------------------------------
+// tStringIndex Build
+//----------------------------------------------------------------------
+void tStringIndex::Build()
+{
+  // load factor of at most 0.5 keeps probe sequences short
+  size_t slot_count = 4;
+  while (slot_count < strings.size() * 2)
+  {
+    slot_count *= 2;
+  }
+  slots.assign(slot_count, tSlot { 0, -1 });
+  mask = slot_count - 1;
+
+  for (size_t i = 0; i < strings.size(); i++)
+  {
+    if (Find(strings[i]) >= 0)
+    {
+      continue; // duplicate: keep first occurrence
+    }
+    uint32_t hash = Hash(strings[i].c_str(), strings[i].length());
+    size_t slot_index = hash & mask;
+    while (slots[slot_index].index >= 0)
+    {
+      slot_index = (slot_index + 1) & mask;
+    }
+    slots[slot_index].hash = hash;
+    slots[slot_index].index = static_cast<int32_t>(i);
+  }
+}
+
+//----------------------------------------------------------------------
+// tStringIndex Find
+//----------------------------------------------------------------------
+int tStringIndex::Find(const char* string, size_t length) const
+{
+  if (slots.empty())
+  {
+    return -1;
+  }
+  uint32_t hash = Hash(string, length);
+  for (size_t slot_index = hash & mask; slots[slot_index].index >= 0; slot_index = (slot_index + 1) & mask)
+  {
+    const tSlot& slot = slots[slot_index];
+    if (slot.hash == hash)
+    {
+      const std::string& candidate = strings[slot.index];
+      if (candidate.length() == length && memcmp(candidate.data(), string, length) == 0)
+      {
+        return slot.index;
+      }
+    }
+  }
+  return -1;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
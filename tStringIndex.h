@@ -0,0 +1,200 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tStringIndex.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tStringIndex
+ *
+ * \b tStringIndex
+ *
+ * Immutable lookup table that maps strings to their index in the
+ * sequence of strings it was constructed from.
+ *
+ * Intended as replacement for linear searches such as
+ * sStringUtils::FindStringInArray on tables that are searched often
+ * (e.g. enum names or parameter names). The table is built once
+ * (open addressing with precomputed hash values) - so a lookup
+ * typically costs one hash computation and one string comparison.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tStringIndex_h__
+#define __rrlib__util__tStringIndex_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Immutable string to index lookup table
+/*!
+ * Maps strings to their index in the sequence of strings the table was
+ * constructed from.
+ * If a string occurs multiple times, the index of its first occurrence is
+ * returned (as sStringUtils::FindStringInArray does).
+ *
+ * The table copies all strings on construction - so the original array
+ * need not outlive it.
+ */
+class tStringIndex
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Creates empty table */
+  tStringIndex() :
+    mask(0)
+  {}
+
+  /*!
+   * \param strings Array of strings to create index for
+   * \param number_of_strings Number of strings in array
+   */
+  tStringIndex(const char* const* strings, size_t number_of_strings);
+
+  /*!
+   * \param strings Strings to create index for
+   */
+  tStringIndex(const std::vector<std::string>& strings);
+
+  /*!
+   * \param first Iterator to first string to create index for (anything std::string can be constructed from)
+   * \param last Iterator past the last string
+   */
+  template <typename TIterator>
+  tStringIndex(TIterator first, TIterator last) :
+    strings(first, last),
+    mask(0)
+  {
+    Build();
+  }
+
+  /*!
+   * \param string String to look up
+   * \param length Length of string
+   * \return Index of string - or -1 if string is not in table
+   */
+  int Find(const char* string, size_t length) const;
+
+  int Find(const char* string) const
+  {
+    return Find(string, strlen(string));
+  }
+
+  int Find(const std::string& string) const
+  {
+    return Find(string.c_str(), string.length());
+  }
+
+  /*!
+   * \param index Index of string
+   * \return String with the specified index
+   */
+  const std::string& GetString(size_t index) const
+  {
+    return strings[index];
+  }
+
+  /*!
+   * \return Number of strings the table was constructed from
+   */
+  size_t Size() const
+  {
+    return strings.size();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Entry in hash table */
+  struct tSlot
+  {
+    /*! Precomputed hash value of string */
+    uint32_t hash;
+
+    /*! Index of string in 'strings' (-1 if slot is empty) */
+    int32_t index;
+  };
+
+  /*! Strings in the order provided to constructor */
+  std::vector<std::string> strings;
+
+  /*! Hash table (size is power of two; linear probing) */
+  std::vector<tSlot> slots;
+
+  /*! Bit mask to obtain slot index from hash value (slots.size() - 1) */
+  size_t mask;
+
+
+  /*! Fills hash table with the contents of 'strings' */
+  void Build();
+
+  /*! Hash function used for table (FNV-1a) */
+  static uint32_t Hash(const char* string, size_t length)
+  {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+      hash = (hash ^ static_cast<unsigned char>(string[i])) * 16777619u;
+    }
+    return hash;
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,389 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tStringSwitch.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tStringSwitch
+ *
+ * \b tStringSwitch
+ *
+ * Maps a fixed set of strings - known at compile time - to their index
+ * using a perfect hash function that is computed by the compiler.
+ * Lookups require a single pass over the key and a single string
+ * comparison (regardless of the number of strings).
+ *
+ * Intended to replace chains of string comparisons in e.g. protocol or
+ * config dispatch:
+ *
+ *   enum class tCommand { START, STOP, RESET, UNKNOWN };
+ *   constexpr auto cCOMMANDS = MakeStringSwitch("start", "stop", "reset");
+ *
+ *   switch (cCOMMANDS.Find(name, tCommand::UNKNOWN))
+ *   {
+ *   case tCommand::START:
+ *   ...
+ *
+ * Construction uses the "hash and displace" scheme: keys are distributed
+ * to buckets with a first hash function. For every bucket, a seed for a
+ * second hash function is searched that places all its keys in free slots.
+ * Both hash functions are derived from the same 64 bit key hash.
+ * (if two keys have the same 64 bit hash, compilation fails)
+ * Buckets are processed in order of decreasing size.
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tStringSwitch_h__
+#define __rrlib__util__tStringSwitch_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <array>
+#include <string_view>
+#include <cstdint>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tIntegerSequence.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*!
+ * Hash function for tStringSwitch - the only pass over the key
+ * (consumes eight characters per step; the result is well mixed in all bits)
+ */
+constexpr uint64_t StringSwitchHash(std::string_view string)
+{
+  uint64_t hash = 0x9e3779b97f4a7c15ull ^ string.length();
+  size_t position = 0;
+  while (position < string.length())
+  {
+    uint64_t word = 0;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (!__builtin_is_constant_evaluated() && position + 8 <= string.length())
+    {
+      // at runtime, load full words directly (same value as assembled below on little endian platforms)
+      __builtin_memcpy(&word, string.data() + position, 8);
+      position += 8;
+    }
+    else
+#endif
+    {
+      for (size_t i = 0; i < 8 && position < string.length(); i++, position++)
+      {
+        word |= static_cast<uint64_t>(static_cast<unsigned char>(string[position])) << (8 * i);
+      }
+    }
+    hash = (hash ^ word) * 0xff51afd7ed558ccdull;
+    hash = (hash << 29) | (hash >> 35);
+  }
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/*!
+ * \return Bucket of key with the provided hash value
+ */
+constexpr size_t StringSwitchBucket(uint64_t hash, size_t bucket_count)
+{
+  return static_cast<size_t>(hash >> 32) & (bucket_count - 1);
+}
+
+/*!
+ * \return Slot of key with the provided hash value for the provided seed
+ */
+constexpr size_t StringSwitchSlot(uint64_t hash, uint32_t seed, size_t slot_count)
+{
+  return static_cast<size_t>(((hash ^ (seed * 0x9e3779b97f4a7c15ull)) * 0xd6e8feb86659fd93ull) >> 32) & (slot_count - 1);
+}
+
+constexpr size_t StringSwitchPowerOfTwo(size_t minimum)
+{
+  size_t result = 1;
+  while (result < minimum)
+  {
+    result *= 2;
+  }
+  return result;
+}
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Compile-time perfect hash from strings to indices
+/*!
+ * Maps a fixed set of strings - known at compile time - to their index
+ * using a perfect hash function.
+ * Objects are typically created with MakeStringSwitch() and stored in
+ * constexpr variables. Referenced strings are not copied - so they must
+ * outlive this object (string literals do).
+ *
+ * Duplicate keys are rejected at compile time.
+ *
+ * \tparam Tsize Number of strings
+ */
+template <size_t Tsize>
+class tStringSwitch
+{
+  /*! Number of buckets for first hash function */
+  static constexpr size_t cBUCKET_COUNT = internal::StringSwitchPowerOfTwo(Tsize);
+
+  /*! Number of slots in table (load factor is at most 0.5) */
+  static constexpr size_t cSLOT_COUNT = internal::StringSwitchPowerOfTwo(2 * Tsize);
+
+  /*! Bail out if no seed is found for a bucket after this many attempts (should never happen) */
+  static constexpr uint32_t cMAX_SEED = 100000;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param keys Strings to create switch for (index in this array is the lookup result)
+   */
+  constexpr explicit tStringSwitch(const std::array<std::string_view, Tsize>& keys) :
+    keys(keys),
+    seeds(),
+    slots()
+  {
+    for (auto & slot : slots)
+    {
+      slot = -1;
+    }
+
+    // sort keys by bucket (counting sort)
+    std::array<uint64_t, Tsize> key_hash {};
+    std::array<size_t, Tsize> key_bucket {};
+    std::array<size_t, cBUCKET_COUNT + 1> bucket_begin {};
+    size_t max_bucket_size = 0;
+    for (size_t i = 0; i < Tsize; i++)
+    {
+      for (size_t j = 0; j < i; j++)
+      {
+        if (keys[i] == keys[j])
+        {
+          throw std::invalid_argument("Duplicate key in tStringSwitch");
+        }
+      }
+      key_hash[i] = internal::StringSwitchHash(keys[i]);
+      key_bucket[i] = internal::StringSwitchBucket(key_hash[i], cBUCKET_COUNT);
+      bucket_begin[key_bucket[i] + 1]++;
+    }
+    for (size_t i = 0; i < cBUCKET_COUNT; i++)
+    {
+      max_bucket_size = bucket_begin[i + 1] > max_bucket_size ? bucket_begin[i + 1] : max_bucket_size;
+      bucket_begin[i + 1] += bucket_begin[i];
+    }
+    std::array<size_t, Tsize> bucket_keys {};
+    std::array<size_t, cBUCKET_COUNT> bucket_fill {};
+    for (size_t i = 0; i < Tsize; i++)
+    {
+      size_t bucket = key_bucket[i];
+      bucket_keys[bucket_begin[bucket] + bucket_fill[bucket]] = i;
+      bucket_fill[bucket]++;
+    }
+
+    // place buckets in order of decreasing size
+    for (size_t size = max_bucket_size; size > 0; size--)
+    {
+      for (size_t bucket = 0; bucket < cBUCKET_COUNT; bucket++)
+      {
+        if (bucket_fill[bucket] != size)
+        {
+          continue;
+        }
+        for (uint32_t seed = 1; ; seed++)
+        {
+          if (seed > cMAX_SEED)
+          {
+            throw std::logic_error("No perfect hash function found for tStringSwitch");
+          }
+          if (TryPlaceKeys(&bucket_keys[bucket_begin[bucket]], size, key_hash, seed))
+          {
+            seeds[bucket] = seed;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  /*!
+   * \param key String to look up
+   * \return Index of key - or -1 if key is not one of the strings this switch was created from
+   */
+  constexpr int Find(std::string_view key) const
+  {
+    if (Tsize == 0)
+    {
+      return -1;
+    }
+    uint64_t hash = internal::StringSwitchHash(key);
+    int index = slots[internal::StringSwitchSlot(hash, seeds[internal::StringSwitchBucket(hash, cBUCKET_COUNT)], cSLOT_COUNT)];
+    return (index >= 0 && keys[index] == key) ? index : -1;
+  }
+
+  /*!
+   * \param key String to look up
+   * \param not_found Value to return if key is not one of the strings
+   * \return Index of key converted to TEnum - or not_found
+   */
+  template <typename TEnum>
+  constexpr TEnum Find(std::string_view key, TEnum not_found) const
+  {
+    int index = Find(key);
+    return index >= 0 ? static_cast<TEnum>(index) : not_found;
+  }
+
+  /*!
+   * \param index Index of string
+   * \return String with the specified index
+   */
+  constexpr std::string_view GetString(size_t index) const
+  {
+    return keys[index];
+  }
+
+  /*!
+   * \return Number of strings
+   */
+  static constexpr size_t Size()
+  {
+    return Tsize;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Strings that switch was created from */
+  std::array<std::string_view, Tsize> keys;
+
+  /*! Seed of second hash function for every bucket */
+  std::array<uint32_t, cBUCKET_COUNT> seeds;
+
+  /*! Index of key in every slot (-1 if slot is empty) */
+  std::array<int, cSLOT_COUNT> slots;
+
+
+  /*!
+   * Places keys in table if this is possible without collisions using the provided seed
+   *
+   * \param key_indices Indices of keys to place
+   * \param key_count Number of keys to place
+   * \param key_hash Hash values of all keys
+   * \param seed Seed for hash function
+   * \return Whether keys were placed
+   */
+  constexpr bool TryPlaceKeys(const size_t* key_indices, size_t key_count, const std::array<uint64_t, Tsize>& key_hash, uint32_t seed)
+  {
+    std::array<size_t, Tsize> key_slots {};
+    for (size_t i = 0; i < key_count; i++)
+    {
+      key_slots[i] = internal::StringSwitchSlot(key_hash[key_indices[i]], seed, cSLOT_COUNT);
+      if (slots[key_slots[i]] >= 0)
+      {
+        return false;
+      }
+      for (size_t j = 0; j < i; j++)
+      {
+        if (key_slots[j] == key_slots[i])
+        {
+          return false;
+        }
+      }
+    }
+
+    for (size_t i = 0; i < key_count; i++)
+    {
+      slots[key_slots[i]] = static_cast<int>(key_indices[i]);
+    }
+    return true;
+  }
+};
+
+namespace internal
+{
+template <size_t Tsize, int ... Tindices>
+constexpr tStringSwitch<Tsize> MakeStringSwitch(const char* const(&strings)[Tsize], tIntegerSequence<Tindices...>)
+{
+  return tStringSwitch<Tsize>(std::array<std::string_view, Tsize> { std::string_view(strings[Tindices])... });
+}
+}
+
+/*!
+ * Creates tStringSwitch from the provided strings
+ * (typically string literals, index of a string is its position in the argument list)
+ *
+ * \param strings Strings to create switch for
+ * \return tStringSwitch
+ */
+template <typename ... TStrings>
+constexpr tStringSwitch<sizeof...(TStrings)> MakeStringSwitch(const TStrings& ... strings)
+{
+  return tStringSwitch<sizeof...(TStrings)>(std::array<std::string_view, sizeof...(TStrings)> { std::string_view(strings)... });
+}
+
+/*!
+ * Creates tStringSwitch from a constexpr array of strings
+ * (e.g. an existing table of enum names)
+ *
+ * \param strings Strings to create switch for
+ * \return tStringSwitch
+ */
+template <size_t Tsize>
+constexpr tStringSwitch<Tsize> MakeStringSwitch(const char* const(&strings)[Tsize])
+{
+  return internal::MakeStringSwitch(strings, typename tIntegerSequenceGenerator<Tsize>::type());
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
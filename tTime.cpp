@@ -29,6 +29,14 @@
 //----------------------------------------------------------------------
 #include "rrlib/util/tTime.h"
 
+#include <algorithm>
+#include <atomic>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
 #ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
 #include "rrlib/serialization/tInputStream.h"
 #include "rrlib/serialization/tOutputStream.h"
@@ -42,35 +50,228 @@ namespace rrlib
 namespace util
 {
 
-const tTime tTime::time_forever(-1, 0);
-const tTime tTime::time_0ms(0, 0);
-const tTime tTime::time_1us(0, 1);
-const tTime tTime::time_1ms(0, 1000);
-const tTime tTime::time_5ms(0, 5000);
-const tTime tTime::time_10ms(0, 10000);
-const tTime tTime::time_20ms(0, 20000);
-const tTime tTime::time_25ms(0, 25000);
-const tTime tTime::time_30ms(0, 30000);
-const tTime tTime::time_40ms(0, 40000);
-const tTime tTime::time_50ms(0, 50000);
-const tTime tTime::time_100ms(0, 100000);
-const tTime tTime::time_200ms(0, 200000);
-const tTime tTime::time_250ms(0, 250000);
-const tTime tTime::time_300ms(0, 300000);
-const tTime tTime::time_400ms(0, 400000);
-const tTime tTime::time_500ms(0, 500000);
-const tTime tTime::time_1s(1, 0);
-const tTime tTime::time_2s(2, 0);
-const tTime tTime::time_5s(5, 0);
-const tTime tTime::time_10s(10, 0);
-const tTime tTime::time_30s(30, 0);
-const tTime tTime::time_60s(60, 0);
-const tTime tTime::time_120s(120, 0);
-const tTime tTime::time_180s(180, 0);
-const tTime tTime::time_240s(240, 0);
-const tTime tTime::time_30000s(30000, 0);
-const tTime tTime::time_1year(365 * 86400, 0);
+namespace internal
+{
+namespace
+{
+
+long long ReadMonotonicClock()
+{
+  timespec ntime;
+  clock_gettime(CLOCK_MONOTONIC, &ntime);
+  return ntime.tv_sec * 1000000000LL + ntime.tv_nsec;
+}
+
+#if defined(__x86_64__)
+
+/*! Duration of TSC calibration in nanoseconds */
+const long long cTSC_CALIBRATION_DURATION = 20000000;
+
+/*! Interval after which tClockSource::TSC is re-anchored to CLOCK_MONOTONIC (in nanoseconds) */
+const long long cTSC_RESYNC_INTERVAL = 1000000000;
+
+/*!
+ * Converts time stamp counter values to CLOCK_MONOTONIC nanoseconds.
+ *
+ * The rate is calibrated once (busy-waiting cTSC_CALIBRATION_DURATION) on first use.
+ * As this calibration is not exact and CLOCK_MONOTONIC is slewed by NTP, the reader
+ * that notices that cTSC_RESYNC_INTERVAL has passed re-anchors the conversion to a
+ * fresh CLOCK_MONOTONIC sample and re-estimates the rate from the last interval.
+ * If the TSC clock is ahead of CLOCK_MONOTONIC, the lead is absorbed by a slightly
+ * lower rate during the next interval - so the TSC clock never jumps backwards.
+ *
+ * Readers obtain a consistent anchor via a sequence lock.
+ */
+class tTSCClock
+{
+public:
+
+  tTSCClock() : available(false), resync_interval_ticks(0), sequence(0), base_ticks(0), base_nsec(0), nsec_per_tick(0), sample_ticks(0), sample_nsec(0)
+  {
+    unsigned int eax, ebx, ecx, edx;
+    if ((!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) || (!(edx & (1 << 8))))
+    {
+      return;
+    }
+
+    unsigned long long start_ticks = 0, end_ticks = 0;
+    long long start_nsec = Sample(start_ticks);
+    long long end_nsec = start_nsec;
+    while (end_nsec - start_nsec < cTSC_CALIBRATION_DURATION)
+    {
+      end_nsec = Sample(end_ticks);
+    }
+    if (end_ticks <= start_ticks)
+    {
+      return;
+    }
+    unsigned long long rate = static_cast<unsigned long long>(((static_cast<unsigned __int128>(end_nsec - start_nsec)) << 32) / (end_ticks - start_ticks));
+    if (rate == 0)
+    {
+      return;
+    }
+    resync_interval_ticks = static_cast<unsigned long long>((static_cast<unsigned __int128>(cTSC_RESYNC_INTERVAL) << 32) / rate);
+    base_ticks.store(end_ticks, std::memory_order_relaxed);
+    base_nsec.store(end_nsec, std::memory_order_relaxed);
+    nsec_per_tick.store(rate, std::memory_order_relaxed);
+    sample_ticks = end_ticks;
+    sample_nsec = end_nsec;
+    available = true;
+  }
+
+  /*! Whether an invariant TSC is available */
+  bool Available() const
+  {
+    return available;
+  }
+
+  /*! \return Current time in nanoseconds */
+  long long Read()
+  {
+    unsigned long long ticks = __rdtsc();
+    unsigned long long anchor_ticks;
+    long long anchor_nsec;
+    unsigned long long rate;
+    LoadAnchor(anchor_ticks, anchor_nsec, rate);
+    if (static_cast<long long>(ticks - anchor_ticks) > static_cast<long long>(resync_interval_ticks) && !resync_in_progress.test_and_set(std::memory_order_acquire))
+    {
+      Resync();
+      resync_in_progress.clear(std::memory_order_release);
+      LoadAnchor(anchor_ticks, anchor_nsec, rate);
+    }
+    return Convert(ticks, anchor_ticks, anchor_nsec, rate);
+  }
+
+private:
+
+  /*! Whether an invariant TSC is available */
+  bool available;
+
+  /*! Number of ticks corresponding to cTSC_RESYNC_INTERVAL */
+  unsigned long long resync_interval_ticks;
+
+  /*! Sequence lock for anchor (odd while anchor is modified) */
+  std::atomic<unsigned int> sequence;
 
+  /*! Anchor: TSC value, time in nanoseconds at this value and nanoseconds per tick as 32.32 fixed point value */
+  std::atomic<unsigned long long> base_ticks;
+  std::atomic<long long> base_nsec;
+  std::atomic<unsigned long long> nsec_per_tick;
+
+  /*! Last sample of TSC and CLOCK_MONOTONIC (only accessed by thread that re-anchors) */
+  unsigned long long sample_ticks;
+  long long sample_nsec;
+
+  /*! Set while a thread re-anchors */
+  std::atomic_flag resync_in_progress = ATOMIC_FLAG_INIT;
+
+  static long long Convert(unsigned long long ticks, unsigned long long anchor_ticks, long long anchor_nsec, unsigned long long rate)
+  {
+    long long elapsed_ticks = static_cast<long long>(ticks - anchor_ticks);
+    return anchor_nsec + static_cast<long long>((static_cast<__int128>(elapsed_ticks) * rate) >> 32);
+  }
+
+  void LoadAnchor(unsigned long long& anchor_ticks, long long& anchor_nsec, unsigned long long& rate) const
+  {
+    while (true)
+    {
+      unsigned int sequence_before = sequence.load(std::memory_order_acquire);
+      anchor_ticks = base_ticks.load(std::memory_order_relaxed);
+      anchor_nsec = base_nsec.load(std::memory_order_relaxed);
+      rate = nsec_per_tick.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if ((sequence_before & 1) == 0 && sequence.load(std::memory_order_relaxed) == sequence_before)
+      {
+        return;
+      }
+    }
+  }
+
+  /*! Re-anchors conversion to a fresh CLOCK_MONOTONIC sample */
+  void Resync()
+  {
+    unsigned long long ticks = 0;
+    long long nsec = Sample(ticks);
+    if (ticks <= sample_ticks || nsec <= sample_nsec)
+    {
+      return;
+    }
+
+    unsigned long long anchor_ticks;
+    long long anchor_nsec;
+    unsigned long long rate;
+    LoadAnchor(anchor_ticks, anchor_nsec, rate);
+    long long current = Convert(ticks, anchor_ticks, anchor_nsec, rate);
+
+    // rate measured over the last interval - reduced so that a lead over CLOCK_MONOTONIC is absorbed during the next interval
+    long long interval_nsec = nsec - sample_nsec;
+    long long lead = std::min(std::max(current - nsec, 0LL), interval_nsec / 2);
+    unsigned long long new_rate = static_cast<unsigned long long>(((static_cast<unsigned __int128>(interval_nsec - lead)) << 32) / (ticks - sample_ticks));
+
+    unsigned int sequence_before = sequence.load(std::memory_order_relaxed);
+    sequence.store(sequence_before + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    base_ticks.store(ticks, std::memory_order_relaxed);
+    base_nsec.store(std::max(current, nsec), std::memory_order_relaxed);
+    nsec_per_tick.store(new_rate, std::memory_order_relaxed);
+    sequence.store(sequence_before + 2, std::memory_order_release);
+
+    sample_ticks = ticks;
+    sample_nsec = nsec;
+  }
+
+  /*!
+   * Reads TSC and CLOCK_MONOTONIC at (almost) the same time
+   * (takes the best of several attempts in order to minimize effect of interrupts)
+   *
+   * \param ticks Contains TSC value after call
+   * \return CLOCK_MONOTONIC in nanoseconds
+   */
+  static long long Sample(unsigned long long& ticks)
+  {
+    long long best_nsec = 0, best_window = -1;
+    for (int i = 0; i < 5; i++)
+    {
+      unsigned long long before = __rdtsc();
+      long long nsec = ReadMonotonicClock();
+      unsigned long long after = __rdtsc();
+      long long window = static_cast<long long>(after - before);
+      if (best_window < 0 || window < best_window)
+      {
+        best_window = window;
+        best_nsec = nsec;
+        ticks = before + (after - before) / 2;
+      }
+    }
+    return best_nsec;
+  }
+};
+
+#endif
+
+}
+
+long long ReadTSCClock()
+{
+#if defined(__x86_64__)
+  static tTSCClock clock;
+  if (clock.Available())
+  {
+    return clock.Read();
+  }
+#endif
+  return ReadMonotonicClock();
+}
+
+}
+
+void tTime::InitializeClock(tClockSource source)
+{
+  if (source == tClockSource::TSC)
+  {
+    internal::ReadTSCClock();
+  }
+}
 
 #ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
 serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tTime &t)
@@ -82,8 +283,9 @@ serialization::tOutputStream &operator << (serialization::tOutputStream &stream,
 
 serialization::tInputStream &operator >> (serialization::tInputStream &stream, tTime &t)
 {
-  t.SetTvSec(static_cast<long>(stream.ReadLong()));
-  t.SetTvUSec(static_cast<long>(stream.ReadLong()));
+  long sec = static_cast<long>(stream.ReadLong());
+  long usec = static_cast<long>(stream.ReadLong());
+  t = tTime(sec, usec);
   return stream;
 }
 
@@ -33,7 +33,9 @@
 #define _util_tTime_h_
 
 #include <sys/time.h>
+#include <time.h>
 #include <iostream>
+#include <type_traits>
 #include "rrlib/time/time.h"
 
 namespace rrlib
@@ -49,107 +51,141 @@ class tOutputStream;
 
 namespace util
 {
+
+/*! Clocks that tTime::Now() can obtain the current time from */
+enum class tClockSource
+{
+  REALTIME,          //!< System time (wall-clock time) - may jump when the system time is adjusted (e.g. via NTP)
+  MONOTONIC,         //!< CLOCK_MONOTONIC - never jumps; time since an unspecified point in the past (typically boot)
+  MONOTONIC_COARSE,  //!< CLOCK_MONOTONIC_COARSE - cheapest monotonic clock; resolution is one scheduler tick (typically 1-4 ms)
+  TSC                //!< CPU time stamp counter calibrated against CLOCK_MONOTONIC (same time base, re-anchored every second); MONOTONIC is used if no invariant TSC is available. The first use busy-waits 20 ms for calibration (see tTime::InitializeClock)
+};
+
+namespace internal
+{
+/*! \return Current time of tClockSource::TSC in nanoseconds */
+long long ReadTSCClock();
+}
+
 //! Repesents times (absolutes and differences)
 /*! Use this class whenever you want to deal with times,
  as it provides a number of operators and functions.
+
+ Internally, a time is a signed 64 bit integer in nanoseconds (this covers
+ roughly +-292 years around 1970). Arithmetic and comparisons are therefore
+ single integer operations. The timeval-like accessors (TvSec(), TvUSec(), ...)
+ round towards negative infinity - so the subsecond part is never negative.
  */
 class tTime
 {
 public:
 
   //! standard constructor, creates a null-time
-  tTime()
-  {
-    tv_sec = 0;
-    tv_usec = 0;
-  }
-  ;
+  constexpr tTime() :
+    nsec(0)
+  {}
 
   //! constructor, takes a timeval for creation
-  tTime(const tTime & t)
-  {
-    tv_sec = t.tv_sec;
-    tv_usec = t.tv_usec;
-  }
+  constexpr tTime(timeval t) :
+    nsec(t.tv_sec * cNSEC_PER_SEC + t.tv_usec * 1000LL)
+  {}
 
-  //! constructor, takes a timeval for creation
-  tTime(timeval t)
-  {
-    tv_sec = t.tv_sec;
-    tv_usec = t.tv_usec;
-  }
+  //! constructor, takes a timespec for creation
+  constexpr tTime(timespec t) :
+    nsec(t.tv_sec * cNSEC_PER_SEC + t.tv_nsec)
+  {}
 
   //! constructor that gets a time in seconds plus microseconds
-  tTime(long sec, long usec)
-  {
-    tv_sec = sec;
-    tv_usec = usec;
-    NormalizeTime();
-  }
+  constexpr tTime(long sec, long usec) :
+    nsec(sec * cNSEC_PER_SEC + usec * 1000LL)
+  {}
 
   //! constructor that gets a time in seconds plus microseconds
-  tTime(const rrlib::time::tTimestamp &timestamp)
-  {
+  tTime(const rrlib::time::tTimestamp &timestamp) :
     // 1970-01-01T00:00:00+00:00
-    const rrlib::time::tTimestamp unix_timestamp = std::chrono::system_clock::from_time_t(0);
-    rrlib::time::tDuration duration = timestamp - unix_timestamp;
-    tv_sec = std::chrono::duration_cast <std::chrono::seconds> (duration).count();
-    tv_usec = std::chrono::duration_cast <std::chrono::microseconds> (duration).count() - tv_sec * 1000000;
-    NormalizeTime();
-  }
+    nsec(std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp - std::chrono::system_clock::from_time_t(0)).count())
+  {}
 
   //! This static function returns a tTime that contains the current System-time
   static inline tTime Now()
   {
-    timeval ntime;
-    gettimeofday(&ntime, 0);
+    timespec ntime;
+    clock_gettime(CLOCK_REALTIME, &ntime);
     return tTime(ntime);
   }
 
-  /*! Returns the time of the current thread (time elapsed since start
-   of thread. It exists only for internal MCA usage. You do not need
-   to call it directly. */
+  /*! Returns a tTime that contains the current time of the specified clock.
+   * Times of different clock sources must not be mixed - except for MONOTONIC,
+   * MONOTONIC_COARSE and TSC which share the same time base. TSC is re-anchored
+   * to CLOCK_MONOTONIC every second, so it follows NTP slewing and deviates by
+   * no more than a few microseconds. It never jumps backwards.
+   * Use monotonic clocks for timeouts and cycle times, as they are not affected
+   * by adjustments of the system time.
+   */
+  static inline tTime Now(tClockSource source)
+  {
+    timespec ntime;
+    switch (source)
+    {
+    case tClockSource::REALTIME:
+      return Now();
+    case tClockSource::MONOTONIC:
+      clock_gettime(CLOCK_MONOTONIC, &ntime);
+      break;
+    case tClockSource::MONOTONIC_COARSE:
+#ifdef CLOCK_MONOTONIC_COARSE
+      clock_gettime(CLOCK_MONOTONIC_COARSE, &ntime);
+#else
+      clock_gettime(CLOCK_MONOTONIC, &ntime);
+#endif
+      break;
+    case tClockSource::TSC:
+      return tTime().FromNSec(internal::ReadTSCClock());
+    }
+    return tTime(ntime);
+  }
+
+  /*! Performs one-time initialization of a clock source - so that the first
+   * call to Now(source) is not delayed (e.g. TSC calibration busy-waits 20 ms).
+   * Call this during initialization of time-critical threads. Thread-safe.
+   */
+  static void InitializeClock(tClockSource source);
+
+  /*! Returns the CPU time consumed by the current thread (CLOCK_THREAD_CPUTIME_ID).
+   For accounting the CPU time of code regions, see tCPUTimeAccount. */
   static inline tTime TaskTime()
   {
-    return tTime(0, clock() * (clock_t(1000000) / CLOCKS_PER_SEC));
+    timespec ntime;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ntime);
+    return tTime(ntime);
   }
 
-  /*! Returns a time that is calculated by tTime::Now()+tTime(0,usec)
+  /*! Returns a time that is calculated by tTime::Now(source)+tTime(0,usec)
    */
-  static inline tTime FutureUSec(long usec)
+  static inline tTime FutureUSec(long usec, tClockSource source = tClockSource::REALTIME)
   {
-    tTime ntime(0, usec);
-    //FromUSec(usec);
-    ntime += tTime::Now();
-    return ntime;
+    return tTime(0, usec) + tTime::Now(source);
   }
 
   /*! Returns a time that is calculated by
-   tTime::Now()+tTime.FromMSec(msec)
+   tTime::Now(source)+tTime.FromMSec(msec)
    */
-  static inline tTime FutureMSec(long msec)
+  static inline tTime FutureMSec(long msec, tClockSource source = tClockSource::REALTIME)
   {
-    tTime ntime(0, msec * 1000);
-    //FromMSec(msec);
-    ntime += tTime::Now();
-    return ntime;
+    return tTime().FromMSec(msec) + tTime::Now(source);
   }
 
-  /*! Returns a time that is calculated by tTime::Now()+tTime(sec,0)
+  /*! Returns a time that is calculated by tTime::Now(source)+tTime(sec,0)
    */
-  static inline tTime FutureSec(long sec)
+  static inline tTime FutureSec(long sec, tClockSource source = tClockSource::REALTIME)
   {
-    tTime ntime(sec, 0);
-    //FromSec(sec);
-    ntime += tTime::Now();
-    return ntime;
+    return tTime(sec, 0) + tTime::Now(source);
   }
 
   /*! Sets tTime to zero. Return value is tTime itself. */
-  inline tTime FromZero()
+  constexpr tTime FromZero()
   {
-    tv_usec = 0;
-    tv_sec = 0;
+    nsec = 0;
     return *this;
   }
 
@@ -168,231 +204,249 @@ public:
   }
 
   /*! Sets tTime to tTime(sec,0). Return value is tTime itself. */
-  inline tTime FromSec(long sec)
+  constexpr tTime FromSec(long sec)
   {
-    *this = tTime(sec, 0);
+    nsec = sec * cNSEC_PER_SEC;
     return *this;
   }
 
-  /*! Splits msec in sec and usec and sets tTime to tTime(sec,usec). Return value is tTime itsself. */
-  inline tTime FromMSec(long msec)
+  /*! Sets tTime to msec milliseconds. Return value is tTime itsself. */
+  constexpr tTime FromMSec(long msec)
   {
-    if (msec < 0)
-      *this = tTime(msec / 1000 - 1, ((msec % 1000) + 1000) * 1000);
-    else
-      *this = tTime(msec / 1000, (msec % 1000) * 1000);
+    nsec = msec * 1000000LL;
     return *this;
   }
-  inline tTime FromUSec(long usec)
+
+  /*! Sets tTime to usec microseconds. Return value is tTime itsself. */
+  constexpr tTime FromUSec(long usec)
   {
-    if (usec < 0)
-      *this = tTime(usec / 1000000 - 1, (usec % 1000000) + 1000000);
-    else
-      *this = tTime(usec / 1000000, usec % 1000000);
+    nsec = usec * 1000LL;
+    return *this;
+  }
+
+  /*! Sets tTime to nsec nanoseconds. Return value is tTime itsself. */
+  constexpr tTime FromNSec(long long nsec)
+  {
+    this->nsec = nsec;
     return *this;
   }
 
   /*! Compares a tTime with zero. */
-  inline bool IsZero() const
+  constexpr bool IsZero() const
   {
-    return ((tv_usec == 0) && (tv_sec == 0));
+    return nsec == 0;
   }
 
   /*! Returns tTime in nanoseconds */
-  inline long long ToNSec() const
+  constexpr long long ToNSec() const
   {
-    return ((long long)tv_usec + (long long)tv_sec * 1000000) * 1000;
+    return nsec;
   }
 
-  /*! Returns tTime in microseconds */
-  inline long long ToUSec() const
+  /*! Returns tTime in microseconds rounded down to an long integer. */
+  constexpr long long ToUSec() const
   {
-    return (long long)tv_usec + (long long)tv_sec * 1000000;
+    return FloorDivide(nsec, 1000);
   }
 
   /*! Returns tTime in milli seconds rounded down to an long integer.*/
-  inline long long ToMSec() const
+  constexpr long long ToMSec() const
   {
-    return (long long)tv_usec / 1000 + (long long)tv_sec * 1000;
+    return FloorDivide(nsec, 1000000);
   }
 
   /*! Returns tTime in seconds rounded down to an long integer.*/
-  inline long ToSec() const
+  constexpr long ToSec() const
   {
-    return tv_sec;
+    return TvSec();
   }
 
   /*! Don't use this function: Returns the tv_sec value if timeval which is the basis of tTime */
-  inline long TvSec() const
+  constexpr long TvSec() const
   {
-    return tv_sec;
+    return static_cast<long>(FloorDivide(nsec, cNSEC_PER_SEC));
   }
 
   /*! Don't use this function: Returns the tv_usec value if timeval which is the basis of tTime */
-  inline long TvUSec() const
+  constexpr long TvUSec() const
   {
-    return tv_usec;
+    return TvNSec() / 1000;
   }
 
-  /*! Don't use this function: Returns the tv_usec value if timeval which is the basis of tTime */
-  inline long TvNSec() const
+  /*! Don't use this function: Returns the tv_nsec value if timespec which is the basis of tTime */
+  constexpr long TvNSec() const
   {
-    return tv_usec * 1000;
+    return static_cast<long>(nsec - FloorDivide(nsec, cNSEC_PER_SEC) * cNSEC_PER_SEC);
   }
 
   /*! Don't use this function: Sets the internal tv_sec variable of timeval */
-  inline void SetTvSec(long new_tv_sec)
+  constexpr void SetTvSec(long new_tv_sec)
   {
-    tv_sec = new_tv_sec;
+    nsec = new_tv_sec * cNSEC_PER_SEC + TvNSec();
   }
 
   /*! Don't use this function: Sets the internal tv_usec variable of timeval */
-  inline void SetTvUSec(long new_tv_usec)
+  constexpr void SetTvUSec(long new_tv_usec)
   {
-    tv_usec = new_tv_usec;
+    nsec = FloorDivide(nsec, cNSEC_PER_SEC) * cNSEC_PER_SEC + new_tv_usec * 1000LL;
   }
 
   /*! Use this function if you want to express the time in hours, minutes and seconds */
-  inline int Hours() const
+  constexpr int Hours() const
   {
-    return tv_sec / 3600 % 24;
+    return TvSec() / 3600 % 24;
   }
 
   /*! Use this function if you want to express the time in hours, minutes and seconds */
-  inline int Minutes() const
+  constexpr int Minutes() const
   {
-    return (tv_sec % 3600) / 60;
+    return (TvSec() % 3600) / 60;
   }
 
   /*! Use this function if you want to express the time in hours, minutes and seconds */
-  inline int Seconds() const
+  constexpr int Seconds() const
   {
-    return (tv_sec % 3600) % 60;
+    return (TvSec() % 3600) % 60;
   }
 
   /*! Use this function if you want to get the subseconds in milliseconds (rounded) */
-  inline int MSeconds() const
+  constexpr int MSeconds() const
   {
-    return tv_usec / 1000;
+    return TvNSec() / 1000000;
   }
 
   /*! Adds two times */
-  inline tTime operator+(const tTime& b) const
+  constexpr tTime operator+(const tTime& b) const
   {
     tTime a = *this;
     return a += b;
   }
 
   /*! Adds a second time */
-  inline tTime operator+=(const tTime& b)
+  constexpr tTime operator+=(const tTime& b)
   {
-    tv_usec += b.tv_usec;
-    tv_sec += b.tv_sec;
-    //NormalizeTimePositive();
-    NormalizeTime();
+    nsec += b.nsec;
     return *this;
   }
 
   /*! Substracts the second time from the first */
-  inline tTime operator-(const tTime& b) const
+  constexpr tTime operator-(const tTime& b) const
   {
     tTime a = *this;
     return a -= b;
   }
 
   /*! Substracts a second time */
-  inline tTime operator-=(const tTime& b)
+  constexpr tTime operator-=(const tTime& b)
   {
-    tv_usec -= b.tv_usec;
-    tv_sec -= b.tv_sec;
-    //NormalizeTimeNegative();
-    NormalizeTime();
+    nsec -= b.nsec;
     return *this;
   }
 
   /*! sign operator */
-  inline tTime operator-() const
+  constexpr tTime operator-() const
   {
-    tTime a(-tv_sec, tv_usec);
-//     a.tv_usec = tv_usec;
-//     a.tv_sec = -tv_sec;
-    return a;
+    return tTime().FromNSec(-nsec);
   }
 
   /*! Multiplies the time by a factor. Uses operator*= (see below). */
-  inline tTime operator*(double factor) const
+  constexpr tTime operator*(double factor) const
   {
     tTime a = *this;
     return a *= factor;
   }
 
   /*! Multiplies by a factor. */
-  inline tTime operator*=(double factor)
+  constexpr tTime operator*=(double factor)
+  {
+    nsec = static_cast<long long>(static_cast<long double>(nsec) * factor);
+    return *this;
+  }
+
+  /*! Multiplies the time by an integer factor (exact - without conversion to floating point) */
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  constexpr tTime operator*(T factor) const
+  {
+    tTime a = *this;
+    return a *= factor;
+  }
+
+  /*! Multiplies by an integer factor (exact - without conversion to floating point) */
+  template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  constexpr tTime operator*=(T factor)
   {
-    tv_usec = (long)(tv_usec * factor);
-    tv_sec = (long)(tv_sec * factor);
-    NormalizeTime();
+    nsec *= factor;
     return *this;
   }
 
   /*! Compares two variables of type tTime. Returns true if they are not equal*/
-  inline bool operator!=(const tTime& b) const
+  constexpr bool operator!=(const tTime& b) const
   {
-    return (tv_usec != b.tv_usec) || (tv_sec != b.tv_sec);
+    return nsec != b.nsec;
   }
 
   /*! Compares two variables of type tTime. Returns true if they are equal*/
-  inline bool operator==(const tTime& b) const
+  constexpr bool operator==(const tTime& b) const
   {
-    return (tv_usec == b.tv_usec) && (tv_sec == b.tv_sec);
+    return nsec == b.nsec;
   }
 
   /*! Compares two variables of type tTime. Returns true if the first one is earlier than the second one*/
-  inline bool operator<(const tTime& b) const
+  constexpr bool operator<(const tTime& b) const
   {
-    return (tv_sec == b.tv_sec) ? (tv_usec < b.tv_usec) : (tv_sec < b.tv_sec);
+    return nsec < b.nsec;
   }
 
   /*! Compares two variables of type tTime. Returns true if the first one is later than the second one*/
-  inline bool operator>(const tTime& b) const
+  constexpr bool operator>(const tTime& b) const
   {
-    return (tv_sec == b.tv_sec) ? (tv_usec > b.tv_usec) : (tv_sec > b.tv_sec);
+    return nsec > b.nsec;
   }
 
   /*! Compares two variables of type tTime. Returns true if the first one is erlier than or equal to the second one*/
-  inline bool operator<=(const tTime& b) const
+  constexpr bool operator<=(const tTime& b) const
   {
-    return (tv_sec == b.tv_sec) ? ((tv_usec == b.tv_usec) || (tv_usec < b.tv_usec)) : (tv_sec < b.tv_sec);
+    return nsec <= b.nsec;
   }
 
   /*! Compares two variables of type tTime. Returns true if the first one is later than or equal to the second one*/
-  inline bool operator>=(const tTime& b) const
+  constexpr bool operator>=(const tTime& b) const
   {
-    return (tv_sec == b.tv_sec) ? ((tv_usec == b.tv_usec) || (tv_usec > b.tv_usec)) : (tv_sec > b.tv_sec);
+    return nsec >= b.nsec;
   }
 
   operator rrlib::time::tTimestamp() const
   {
-    rrlib::time::tTimestamp timestamp = std::chrono::system_clock::from_time_t((time_t) this->tv_sec);
-    return timestamp + std::chrono::duration_cast<rrlib::time::tDuration>(std::chrono::microseconds(this->tv_usec));
+    return std::chrono::system_clock::from_time_t(0) + std::chrono::duration_cast<rrlib::time::tDuration>(std::chrono::nanoseconds(nsec));
   }
 
   /*! Casts this tTime object into timespec object (consists of tv_sec/tv_nsec, see h)*/
-  operator timespec() const
+  constexpr operator timespec() const
+  {
+    timespec t = { TvSec(), TvNSec() };
+    return t;
+  }
+
+  /*! Casts this tTime object into timeval object (consists of tv_sec/tv_usec; nanoseconds are truncated)*/
+  constexpr operator timeval() const
   {
-    timespec t = { tv_sec, 1000 * tv_usec };
+    timeval t = { TvSec(), TvUSec() };
     return t;
   }
 
-  /*! Returns a formatted string for strftime-like-usage instead of getting "(sec, usec)", which is not really readable when used as global timestamp (date) */
+  /*! Returns a formatted string for strftime-like-usage instead of getting "(sec, usec)", which is not really readable when used as global timestamp (date)
+   * (for formatting many timestamps - e.g. in loggers - tTimeFormatter is significantly faster) */
   inline std::string GetString(const std::string &format_string) const
   {
     char buffer[64];
-    strftime(buffer, sizeof(buffer), format_string.c_str(), localtime(&tv_sec));
-    return std::string(buffer);
+    time_t sec = TvSec();
+    tm broken_down_time;
+    localtime_r(&sec, &broken_down_time);
+    size_t length = strftime(buffer, sizeof(buffer), format_string.c_str(), &broken_down_time);
+    return std::string(buffer, length);
   }
 
-  // some standard time intervals to be used for timeouts etc
+  // some standard time intervals to be used for timeouts etc (constexpr - see definitions below)
   static const tTime time_forever;
   static const tTime time_0ms;
   static const tTime time_1us;
@@ -423,28 +477,101 @@ public:
   static const tTime time_1year;
 
 private:
-  long tv_sec;
-  long tv_usec;
 
-  /*! Makes sure that tv_usec lies in the interval [0; 1000000] by:
-   - converting multiples of 1000000 usec into multiples of sec
-   - transforming tv_sec and tv_usec so that the usec part is positive
-   */
-  inline void NormalizeTime()
-  {
-    // test modulo
-    tv_sec = tv_sec + tv_usec / 1000000;
-    tv_usec = tv_usec % 1000000;
+  static constexpr long long cNSEC_PER_SEC = 1000000000LL;
 
-    // ensure that usec part is positive
-    if (tv_usec < 0)
-    {
-      tv_sec--;
-      tv_usec += 1000000;
-    }
+  /*! Time in nanoseconds */
+  long long nsec;
+
+  /*! Integer division that rounds towards negative infinity (divisor must be positive) */
+  static constexpr long long FloorDivide(long long dividend, long long divisor)
+  {
+    long long quotient = dividend / divisor;
+    return (dividend % divisor < 0) ? quotient - 1 : quotient;
   }
 };
 
+inline constexpr tTime tTime::time_forever(-1, 0);
+inline constexpr tTime tTime::time_0ms(0, 0);
+inline constexpr tTime tTime::time_1us(0, 1);
+inline constexpr tTime tTime::time_1ms(0, 1000);
+inline constexpr tTime tTime::time_5ms(0, 5000);
+inline constexpr tTime tTime::time_10ms(0, 10000);
+inline constexpr tTime tTime::time_20ms(0, 20000);
+inline constexpr tTime tTime::time_25ms(0, 25000);
+inline constexpr tTime tTime::time_30ms(0, 30000);
+inline constexpr tTime tTime::time_40ms(0, 40000);
+inline constexpr tTime tTime::time_50ms(0, 50000);
+inline constexpr tTime tTime::time_100ms(0, 100000);
+inline constexpr tTime tTime::time_200ms(0, 200000);
+inline constexpr tTime tTime::time_250ms(0, 250000);
+inline constexpr tTime tTime::time_300ms(0, 300000);
+inline constexpr tTime tTime::time_400ms(0, 400000);
+inline constexpr tTime tTime::time_500ms(0, 500000);
+inline constexpr tTime tTime::time_1s(1, 0);
+inline constexpr tTime tTime::time_2s(2, 0);
+inline constexpr tTime tTime::time_5s(5, 0);
+inline constexpr tTime tTime::time_10s(10, 0);
+inline constexpr tTime tTime::time_30s(30, 0);
+inline constexpr tTime tTime::time_60s(60, 0);
+inline constexpr tTime tTime::time_120s(120, 0);
+inline constexpr tTime tTime::time_180s(180, 0);
+inline constexpr tTime tTime::time_240s(240, 0);
+inline constexpr tTime tTime::time_30000s(30000, 0);
+inline constexpr tTime tTime::time_1year(365 * 86400, 0);
+
+/*!
+ * User-defined literals for tTime (e.g. 5_ms, 1.5_s)
+ * Use 'using namespace rrlib::util::time_literals;' to enable them.
+ */
+inline namespace literals
+{
+inline namespace time_literals
+{
+
+constexpr tTime operator"" _ns(unsigned long long nsec)
+{
+  return tTime().FromNSec(static_cast<long long>(nsec));
+}
+
+constexpr tTime operator"" _us(unsigned long long usec)
+{
+  return tTime().FromNSec(static_cast<long long>(usec) * 1000LL);
+}
+
+constexpr tTime operator"" _ms(unsigned long long msec)
+{
+  return tTime().FromNSec(static_cast<long long>(msec) * 1000000LL);
+}
+
+constexpr tTime operator"" _s(unsigned long long sec)
+{
+  return tTime().FromNSec(static_cast<long long>(sec) * 1000000000LL);
+}
+
+constexpr tTime operator"" _min(unsigned long long min)
+{
+  return tTime().FromNSec(static_cast<long long>(min) * 60000000000LL);
+}
+
+constexpr tTime operator"" _h(unsigned long long hours)
+{
+  return tTime().FromNSec(static_cast<long long>(hours) * 3600000000000LL);
+}
+
+constexpr tTime operator"" _ms(long double msec)
+{
+  return tTime().FromNSec(static_cast<long long>(msec * 1000000.0L));
+}
+
+constexpr tTime operator"" _s(long double sec)
+{
+  return tTime().FromNSec(static_cast<long long>(sec * 1000000000.0L));
+}
+
+}
+}
+
 //! Overloading the << operator for ostream
 /*! Outputs a time as a pair of long integer representing (seconds, microseconds).
  */
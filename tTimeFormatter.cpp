@@ -0,0 +1,181 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tTimeFormatter.cpp
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tTimeFormatter.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+#include <ctime>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tTimeFormatter::cMAX_LENGTH;
+const size_t tTimeFormatter::cMAX_FORMATTED_LENGTH;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * Renders strftime format string for the specified broken-down time
+ *
+ * \return Length of rendered text
+ */
+size_t Render(const std::string& format, const tm& broken_down_time, char* buffer, size_t buffer_size)
+{
+  if (format.empty())
+  {
+    buffer[0] = 0;
+    return 0;
+  }
+  // strftime returns 0 for both empty results (e.g. "%p" in some locales) and overflow - both yield an empty text
+  return strftime(buffer, buffer_size, format.c_str(), &broken_down_time);
+}
+
+}
+
+//----------------------------------------------------------------------
+// tTimeFormatter constructors
+//----------------------------------------------------------------------
+tTimeFormatter::tTimeFormatter(const std::string& format) :
+  prefix_format(format),
+  subsecond_digits(0),
+  subsecond_divisor(1),
+  cached_second(0),
+  cache_valid(false),
+  prefix_length(0),
+  suffix_length(0)
+{
+  // look for sub-second field ("%%" is an escaped '%')
+  for (size_t i = 0; i + 1 < format.length(); i++)
+  {
+    if (format[i] != '%')
+    {
+      continue;
+    }
+    size_t field_end = i + 1;
+    unsigned int digits = 0;
+    if (format[field_end] >= '1' && format[field_end] <= '9')
+    {
+      digits = format[field_end] - '0';
+      field_end++;
+    }
+    if (field_end < format.length() && format[field_end] == 'N')
+    {
+      subsecond_digits = digits ? digits : 9;
+      for (unsigned int d = subsecond_digits; d < 9; d++)
+      {
+        subsecond_divisor *= 10;
+      }
+      prefix_format = format.substr(0, i);
+      suffix_format = format.substr(field_end + 1);
+      break;
+    }
+    i++;  // skip conversion specifier (e.g. second '%' of "%%")
+  }
+}
+
+//----------------------------------------------------------------------
+// tTimeFormatter Format
+//----------------------------------------------------------------------
+size_t tTimeFormatter::Format(const tTime& time, char* buffer, size_t buffer_size)
+{
+  long second = time.TvSec();
+  if (!cache_valid || second != cached_second)
+  {
+    time_t time_value = second;
+    tm broken_down_time;
+    localtime_r(&time_value, &broken_down_time);
+    prefix_length = Render(prefix_format, broken_down_time, prefix, sizeof(prefix));
+    suffix_length = Render(suffix_format, broken_down_time, suffix, sizeof(suffix));
+    cached_second = second;
+    cache_valid = true;
+  }
+
+  size_t length = prefix_length + subsecond_digits + suffix_length;
+  if (length >= buffer_size)
+  {
+    if (buffer_size > 0)
+    {
+      buffer[0] = 0;
+    }
+    return 0;
+  }
+
+  char* output = buffer;
+  memcpy(output, prefix, prefix_length);
+  output += prefix_length;
+  long subsecond = time.TvNSec() / subsecond_divisor;
+  for (unsigned int i = subsecond_digits; i > 0; i--)
+  {
+    output[i - 1] = static_cast<char>('0' + subsecond % 10);
+    subsecond /= 10;
+  }
+  output += subsecond_digits;
+  memcpy(output, suffix, suffix_length);
+  output[suffix_length] = 0;
+  return length;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,169 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tTimeFormatter.h
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tTimeFormatter
+ *
+ * \b tTimeFormatter
+ *
+ * Formats tTime timestamps (e.g. for log messages) into a caller-provided
+ * buffer.
+ *
+ * Converting a time to local date and time (localtime_r) and rendering it
+ * with strftime is expensive. As consecutive timestamps typically lie in
+ * the same second, the formatter caches the rendered text for the last
+ * second - and only renders the sub-second digits on every call.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tTimeFormatter_h__
+#define __rrlib__util__tTimeFormatter_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tTime.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Fast timestamp formatting
+/*!
+ * Formats times with a strftime format string.
+ * In addition to the strftime conversions, the format string may contain
+ * one sub-second field "%<digits>N" (as in 'date'): e.g. "%3N" for
+ * milliseconds or "%6N" for microseconds ("%N" means nanoseconds).
+ *
+ * The date is rendered in local time (using the thread-safe localtime_r).
+ * The text for the current second is cached - so formatting a timestamp
+ * in the same second as the previous one only copies the cached text and
+ * writes the sub-second digits.
+ *
+ * Objects are not thread-safe: every thread should use its own formatter
+ * (e.g. a thread_local instance).
+ *
+ * Usage:
+ *
+ *   thread_local tTimeFormatter formatter("%Y-%m-%d %H:%M:%S.%3N");
+ *   char buffer[tTimeFormatter::cMAX_FORMATTED_LENGTH];
+ *   size_t length = formatter.Format(tTime::Now(), buffer, sizeof(buffer));
+ */
+class tTimeFormatter
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * Maximum length (including terminating null character) of the formatted text before
+   * and after the sub-second field - longer texts are rendered as empty text
+   */
+  static const size_t cMAX_LENGTH = 128;
+
+  /*! Buffer size that is sufficient for any formatted time (including terminating null character) */
+  static const size_t cMAX_FORMATTED_LENGTH = 2 * cMAX_LENGTH + 10;
+
+  /*!
+   * \param format strftime format string with optional sub-second field (see class description)
+   */
+  explicit tTimeFormatter(const std::string& format = "%Y-%m-%d %H:%M:%S.%3N");
+
+  /*!
+   * Formats time
+   *
+   * \param time Time to format
+   * \param buffer Buffer to write formatted (null-terminated) time to
+   * \param buffer_size Size of buffer
+   * \return Length of formatted time (without terminating null character) - or 0 if buffer is too small
+   */
+  size_t Format(const tTime& time, char* buffer, size_t buffer_size);
+
+  /*!
+   * Formats time
+   *
+   * \param time Time to format
+   * \return Formatted time
+   */
+  std::string Format(const tTime& time)
+  {
+    char buffer[cMAX_FORMATTED_LENGTH];
+    size_t length = Format(time, buffer, sizeof(buffer));
+    return std::string(buffer, length);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! strftime format strings before and after the sub-second field */
+  std::string prefix_format, suffix_format;
+
+  /*! Number of sub-second digits (0 if format string contains no sub-second field) */
+  unsigned int subsecond_digits;
+
+  /*! Divisor to obtain sub-second digits from nanoseconds */
+  long subsecond_divisor;
+
+  /*! Second whose text is cached (TvSec() of tTime) */
+  long cached_second;
+
+  /*! Whether there is any cached text */
+  bool cache_valid;
+
+  /*! Cached prefix and suffix texts for cached_second */
+  char prefix[cMAX_LENGTH], suffix[cMAX_LENGTH];
+  size_t prefix_length, suffix_length;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
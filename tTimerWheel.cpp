@@ -0,0 +1,279 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tTimerWheel.cpp
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/util/tTimerWheel.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const unsigned int tTimerWheel::cLEVEL_BITS;
+const unsigned int tTimerWheel::cLEVELS;
+const uint64_t tTimerWheel::cSLOTS;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tTimerWheel constructors
+//----------------------------------------------------------------------
+tTimerWheel::tTimerWheel(const tTime& resolution, tClockSource clock_source) :
+  resolution(resolution),
+  clock_source(clock_source),
+  start(tTime::Now(clock_source)),
+  current_time(start),
+  current_tick(0),
+  free_list(-1),
+  slots(cLEVELS * cSLOTS, -1),
+  timer_count(0)
+{
+  assert(resolution > tTime::time_0ms);
+}
+
+//----------------------------------------------------------------------
+// tTimerWheel AddTimer
+//----------------------------------------------------------------------
+tTimerWheel::tTimerId tTimerWheel::AddTimer(const tTime& deadline, tCallback callback)
+{
+  int32_t index = free_list;
+  if (index >= 0)
+  {
+    free_list = timers[index].next;
+  }
+  else
+  {
+    index = static_cast<int32_t>(timers.size());
+    timers.emplace_back();
+    timers.back().generation = 0;
+  }
+  tTimer& timer = timers[index];
+  timer.generation++;
+  timer.active = true;
+  timer.callback = std::move(callback);
+
+  // round up to next tick; timers that are due expire with the next tick
+  long long nsec = (deadline - start).ToNSec();
+  long long resolution_nsec = resolution.ToNSec();
+  long long tick = nsec > 0 ? (nsec + resolution_nsec - 1) / resolution_nsec : 0;
+  timer.expires = std::max<uint64_t>(static_cast<uint64_t>(tick), current_tick + 1);
+
+  Insert(index);
+  timer_count++;
+  return (static_cast<uint64_t>(timer.generation) << 32) | static_cast<uint32_t>(index);
+}
+
+//----------------------------------------------------------------------
+// tTimerWheel Advance
+//----------------------------------------------------------------------
+size_t tTimerWheel::Advance(const tTime& now)
+{
+  if (now > current_time)
+  {
+    current_time = now;
+  }
+  long long nsec = (current_time - start).ToNSec();
+  uint64_t target_tick = nsec > 0 ? static_cast<uint64_t>(nsec / resolution.ToNSec()) : 0;
+
+  expired_callbacks.clear();
+  while (current_tick < target_tick)
+  {
+    if (timer_count == 0)
+    {
+      current_tick = target_tick;
+      break;
+    }
+    current_tick++;
+
+    // when a level wraps around, cascade the next slot of the level above
+    for (unsigned int level = 1; level < cLEVELS; level++)
+    {
+      if ((current_tick & ((1ull << (level * cLEVEL_BITS)) - 1)) != 0)
+      {
+        break;
+      }
+      Cascade(level, (current_tick >> (level * cLEVEL_BITS)) & (cSLOTS - 1));
+    }
+
+    int32_t& slot = slots[current_tick & (cSLOTS - 1)];
+    while (slot >= 0)
+    {
+      int32_t index = slot;
+      tTimer& timer = timers[index];
+      Unlink(index);
+      if (timer.expires > current_tick)
+      {
+        Insert(index);  // clamped timer that is not due yet
+        continue;
+      }
+      expired_callbacks.push_back(std::move(timer.callback));
+      timer.callback = nullptr;
+      timer.active = false;
+      timer.next = free_list;
+      free_list = index;
+      timer_count--;
+    }
+  }
+
+  // callbacks are called from a local vector - so they may call Advance() again
+  std::vector<tCallback> callbacks;
+  callbacks.swap(expired_callbacks);
+  size_t expired = callbacks.size();
+  for (size_t i = 0; i < expired; i++)
+  {
+    callbacks[i]();
+  }
+  callbacks.clear();
+  if (callbacks.capacity() > expired_callbacks.capacity())
+  {
+    callbacks.swap(expired_callbacks);  // reuse memory
+  }
+  return expired;
+}
+
+//----------------------------------------------------------------------
+// tTimerWheel Cancel
+//----------------------------------------------------------------------
+bool tTimerWheel::Cancel(tTimerId id)
+{
+  uint32_t index = static_cast<uint32_t>(id);
+  uint32_t generation = static_cast<uint32_t>(id >> 32);
+  if (index >= timers.size() || (!timers[index].active) || timers[index].generation != generation)
+  {
+    return false;
+  }
+  Unlink(index);
+  tTimer& timer = timers[index];
+  timer.callback = nullptr;
+  timer.active = false;
+  timer.next = free_list;
+  free_list = index;
+  timer_count--;
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tTimerWheel Cascade
+//----------------------------------------------------------------------
+void tTimerWheel::Cascade(unsigned int level, uint64_t slot_in_level)
+{
+  int32_t& slot = slots[level * cSLOTS + slot_in_level];
+  int32_t index = slot;
+  slot = -1;
+  while (index >= 0)
+  {
+    int32_t next = timers[index].next;
+    Insert(index);
+    index = next;
+  }
+}
+
+//----------------------------------------------------------------------
+// tTimerWheel Insert
+//----------------------------------------------------------------------
+void tTimerWheel::Insert(int32_t index)
+{
+  tTimer& timer = timers[index];
+  uint64_t delta = timer.expires - current_tick;
+  uint64_t expires = timer.expires;
+  unsigned int level = 0;
+  while (level < cLEVELS - 1 && delta >= (1ull << ((level + 1) * cLEVEL_BITS)))
+  {
+    level++;
+  }
+  if (level == cLEVELS - 1 && delta >= (1ull << (cLEVELS * cLEVEL_BITS)))
+  {
+    // beyond range of wheel: place in last slot of top level and reinsert when it is processed
+    expires = current_tick + (1ull << (cLEVELS * cLEVEL_BITS)) - 1;
+  }
+  timer.slot = static_cast<uint32_t>(level * cSLOTS + ((expires >> (level * cLEVEL_BITS)) & (cSLOTS - 1)));
+
+  int32_t& slot = slots[timer.slot];
+  timer.previous = -1;
+  timer.next = slot;
+  if (slot >= 0)
+  {
+    timers[slot].previous = index;
+  }
+  slot = index;
+}
+
+//----------------------------------------------------------------------
+// tTimerWheel Unlink
+//----------------------------------------------------------------------
+void tTimerWheel::Unlink(int32_t index)
+{
+  tTimer& timer = timers[index];
+  if (timer.previous >= 0)
+  {
+    timers[timer.previous].next = timer.next;
+  }
+  else
+  {
+    slots[timer.slot] = timer.next;
+  }
+  if (timer.next >= 0)
+  {
+    timers[timer.next].previous = timer.previous;
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
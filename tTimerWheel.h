@@ -0,0 +1,268 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tTimerWheel.h
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tTimerWheel
+ *
+ * \b tTimerWheel
+ *
+ * Manages large numbers of timeouts (e.g. one per connection) efficiently.
+ *
+ * Instead of polling every timeout (O(n) per check), timers are stored in
+ * a hierarchical timing wheel: four levels with 256 slots each. Level 0
+ * has one slot per tick; each higher level has slots that are 256 times
+ * as long. When the lowest level wraps around, the timers of the next slot
+ * of the level above are distributed to the lower levels ("cascading").
+ * Adding and cancelling timers is O(1).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__tTimerWheel_h__
+#define __rrlib__util__tTimerWheel_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include "rrlib/util/tTime.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Hierarchical timing wheel
+/*!
+ * Calls callbacks when their deadlines have passed.
+ *
+ * Time is divided into ticks of configurable resolution. Deadlines are
+ * rounded up to the next tick - so timers never fire early. They fire in
+ * the first call of Advance() whose time is at or after the (rounded)
+ * deadline. Deadlines more than 2^32 ticks in the future are supported
+ * (such timers are cascaded repeatedly).
+ *
+ * Expired timers are collected before their callbacks are called - so
+ * callbacks may add or cancel timers (and even call Advance()).
+ *
+ * Objects are not thread-safe.
+ *
+ * Usage:
+ *
+ *   tTimerWheel wheel(tTime::time_1ms);
+ *   auto id = wheel.AddTimeout(tTime::time_500ms, [&]() { ... });
+ *   ...
+ *   wheel.Cancel(id);
+ *   ...
+ *   wheel.Advance();  // e.g. called periodically by tPeriodicLoop
+ */
+class tTimerWheel : private util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Identifies a timer (0 is never a valid id) */
+  typedef uint64_t tTimerId;
+
+  /*! Callback called when timer expires */
+  typedef std::function<void()> tCallback;
+
+  /*!
+   * \param resolution Tick resolution (duration of one tick)
+   * \param clock_source Clock that deadlines refer to and that Advance() without arguments reads
+   */
+  explicit tTimerWheel(const tTime& resolution, tClockSource clock_source = tClockSource::MONOTONIC);
+
+  /*!
+   * Adds timer that expires at the specified time
+   *
+   * \param deadline Time when timer expires (time of wheel's clock source - e.g. tTime::FutureMSec(500, clock_source))
+   * \param callback Callback to call when timer expires
+   * \return Id of timer
+   */
+  tTimerId AddTimer(const tTime& deadline, tCallback callback);
+
+  /*!
+   * Adds timer that expires after the specified timeout
+   *
+   * \param timeout Timeout relative to the time of the last Advance() call (or construction)
+   * \param callback Callback to call when timer expires
+   * \return Id of timer
+   */
+  tTimerId AddTimeout(const tTime& timeout, tCallback callback)
+  {
+    return AddTimer(current_time + timeout, std::move(callback));
+  }
+
+  /*!
+   * Calls callbacks of all timers whose deadline is at or before the current time of the clock source
+   *
+   * \return Number of expired timers
+   */
+  size_t Advance()
+  {
+    return Advance(tTime::Now(clock_source));
+  }
+
+  /*!
+   * Calls callbacks of all timers whose deadline is at or before the specified time
+   *
+   * \param now Current time
+   * \return Number of expired timers
+   */
+  size_t Advance(const tTime& now);
+
+  /*!
+   * Cancels timer
+   *
+   * \param id Id of timer
+   * \return True if timer was cancelled - false if it already expired or was cancelled
+   */
+  bool Cancel(tTimerId id);
+
+  /*!
+   * \return Time of last Advance() call (or construction)
+   */
+  const tTime& GetCurrentTime() const
+  {
+    return current_time;
+  }
+
+  /*!
+   * \return Tick resolution
+   */
+  const tTime& GetResolution() const
+  {
+    return resolution;
+  }
+
+  /*!
+   * \return Number of pending timers
+   */
+  size_t Size() const
+  {
+    return timer_count;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Bits per level, levels, and slots per level */
+  static const unsigned int cLEVEL_BITS = 8;
+  static const unsigned int cLEVELS = 4;
+  static const uint64_t cSLOTS = 1 << cLEVEL_BITS;
+
+  /*! Timer in pool (doubly linked list of timers in the same slot) */
+  struct tTimer
+  {
+    /*! Tick when timer expires */
+    uint64_t expires;
+
+    /*! Incremented whenever timer is reused (makes ids of expired timers invalid) */
+    uint32_t generation;
+
+    /*! Whether this timer is pending */
+    bool active;
+
+    /*! Slot that timer is in */
+    uint32_t slot;
+
+    /*! Previous and next timer in slot (-1 if none) - next timer in free list if not active */
+    int32_t previous, next;
+
+    tCallback callback;
+  };
+
+  /*! Resolution in nanoseconds */
+  tTime resolution;
+
+  /*! Clock source */
+  tClockSource clock_source;
+
+  /*! Time of tick 0 */
+  tTime start;
+
+  /*! Time of last Advance() call */
+  tTime current_time;
+
+  /*! All ticks up to (including) this one have been processed */
+  uint64_t current_tick;
+
+  /*! Pool of timers */
+  std::vector<tTimer> timers;
+
+  /*! First unused timer in pool (-1 if none) */
+  int32_t free_list;
+
+  /*! First timer in every slot (-1 if slot is empty); cLEVELS * cSLOTS entries */
+  std::vector<int32_t> slots;
+
+  /*! Number of pending timers */
+  size_t timer_count;
+
+  /*! Callbacks of expired timers (member in order to reuse memory) */
+  std::vector<tCallback> expired_callbacks;
+
+
+  /*! Inserts timer into the slot matching its expiry tick */
+  void Insert(int32_t index);
+
+  /*! Removes timer from its slot */
+  void Unlink(int32_t index);
+
+  /*! Moves timers of the specified slot to lower levels */
+  void Cascade(unsigned int level, uint64_t slot_in_level);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
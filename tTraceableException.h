@@ -40,6 +40,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <atomic>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -65,6 +66,10 @@ namespace util
 /*!
  * This class implements an augmentation class that can be used to add a
  * stacktrace to every other exception class.
+ *
+ * Capturing can be disabled for individual exception types (see
+ * EnableBacktrace) in addition to the process-wide settings in
+ * tTraceableExceptionBase.
  */
 template <typename T>
 class tTraceableException : public T, public tTraceableExceptionBase
@@ -77,12 +82,28 @@ public:
 
   template <typename ... TArgs>
 explicit tTraceableException(const TArgs &... args) noexcept :
-  T(args...)
+  T(args...),
+  tTraceableExceptionBase(backtrace_enabled.load(std::memory_order_relaxed))
   {}
 
   ~tTraceableException() noexcept
   {}
 
+  /*!
+   * \param enable Whether stack traces are captured for exceptions of this type (default is true)
+   */
+  static void EnableBacktrace(bool enable)
+  {
+    backtrace_enabled.store(enable, std::memory_order_relaxed);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  static inline std::atomic<bool> backtrace_enabled { true };
+
 };
 
 //----------------------------------------------------------------------
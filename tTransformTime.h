@@ -27,6 +27,9 @@
  *
  * \brief   Contains class tTransformTime
  *
+ * Only applies the offset of the last pair of timestamps. For clocks
+ * with drift, tClockSynchronization estimates offset and skew.
+ *
  */
 //----------------------------------------------------------------------
 
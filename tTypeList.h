@@ -57,6 +57,7 @@ struct tTypeList;
 #include "rrlib/util/type_list/tSizeOf.h"
 #include "rrlib/util/type_list/tAt.h"
 #include "rrlib/util/type_list/tFind.h"
+#include "rrlib/util/type_list/tFilter.h"
 #include "rrlib/util/type_list/tAppend.h"
 #include "rrlib/util/type_list/tAppendList.h"
 #include "rrlib/util/type_list/tRemove.h"
@@ -66,6 +67,7 @@ struct tTypeList;
 #include "rrlib/util/type_list/tReplaceAll.h"
 #include "rrlib/util/type_list/tMostDerived.h"
 #include "rrlib/util/type_list/tDerivedToFront.h"
+#include "rrlib/util/type_list/tNames.h"
 
 #include "rrlib/util/type_list/tTypeListBase.h"
 
@@ -0,0 +1,110 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/clock_benchmark.cpp
+ *
+ * \author  Jens Wettach
+ *
+ * \date    2026-10-19
+ *
+ * Measures the cost of tTime::Now() for the different clock sources.
+ *
+ * For every source, the average duration of a call is reported, as well
+ * as the distribution of differences between consecutive readings
+ * (smallest non-zero difference approximates the resolution; the
+ * maximum shows the jitter caused by e.g. interrupts).
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tTime.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::util;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t cCALLS = 1000000;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+void Measure(const char* name, tClockSource source)
+{
+  std::vector<long long> readings(cCALLS);
+  tTime::InitializeClock(source);  // e.g. TSC calibration
+
+  tTime start = tTime::Now(tClockSource::MONOTONIC);
+  for (size_t i = 0; i < cCALLS; i++)
+  {
+    readings[i] = tTime::Now(source).ToNSec();
+  }
+  long long total_nsec = (tTime::Now(tClockSource::MONOTONIC) - start).ToNSec();
+
+  std::vector<long long> differences;
+  differences.reserve(cCALLS);
+  long long smallest_step = 0;
+  for (size_t i = 1; i < cCALLS; i++)
+  {
+    long long difference = readings[i] - readings[i - 1];
+    differences.push_back(difference);
+    if (difference > 0 && (smallest_step == 0 || difference < smallest_step))
+    {
+      smallest_step = difference;
+    }
+  }
+  std::sort(differences.begin(), differences.end());
+
+  printf("%-18s %7.1f ns/call   step: min>0 %7lld ns  p50 %7lld ns  p99 %7lld ns  max %9lld ns  (backwards: %s)\n",
+         name, static_cast<double>(total_nsec) / cCALLS, smallest_step, differences[differences.size() / 2],
+         differences[differences.size() * 99 / 100], differences.back(), differences.front() < 0 ? "yes" : "no");
+}
+
+int main()
+{
+  Measure("REALTIME", tClockSource::REALTIME);
+  Measure("MONOTONIC", tClockSource::MONOTONIC);
+  Measure("MONOTONIC_COARSE", tClockSource::MONOTONIC_COARSE);
+  Measure("TSC", tClockSource::TSC);
+  return 0;
+}
@@ -0,0 +1,121 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/counter_benchmark.cpp
+ *
+ * \author  Bernd Helge Schaefer
+ *
+ * \date    2026-10-19
+ *
+ * Measures the cost of counting frames (events) from many threads with
+ * a mutex-protected tFPSComputer, a single shared atomic counter and
+ * tConcurrentFPSComputer.
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tConcurrentFPSComputer.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::util;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const int cINCREMENTS_PER_THREAD = 2000000;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+template <typename TIncrement>
+void Measure(const char* name, unsigned int thread_count, TIncrement increment)
+{
+  std::vector<std::thread> threads;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < thread_count; i++)
+  {
+    threads.emplace_back([&increment]()
+    {
+      for (int j = 0; j < cINCREMENTS_PER_THREAD; j++)
+      {
+        increment();
+      }
+    });
+  }
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("%-24s %2u threads: %8.1f million increments/s\n", name, thread_count, thread_count * cINCREMENTS_PER_THREAD / seconds / 1000000);
+}
+
+int main()
+{
+  unsigned int max_threads = std::max(2u, std::thread::hardware_concurrency());
+  for (unsigned int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+  {
+    tFPSComputer fps_computer;
+    std::mutex mutex;
+    Measure("mutex + tFPSComputer", thread_count, [&]()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      fps_computer.IncrementFrameCounter();
+    });
+
+    std::atomic<uint64_t> counter(0);
+    Measure("single atomic counter", thread_count, [&]()
+    {
+      counter.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    tConcurrentFPSComputer concurrent_fps_computer;
+    Measure("tConcurrentFPSComputer", thread_count, [&]()
+    {
+      concurrent_fps_computer.IncrementFrameCounter();
+    });
+  }
+  return 0;
+}
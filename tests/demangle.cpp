@@ -0,0 +1,139 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/demangle.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * Tests demangling functions.
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <map>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+#include "rrlib/util/demangle.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+class TestDemangle : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestDemangle);
+  RRLIB_UNIT_TESTS_ADD_TEST(Demangle);
+  RRLIB_UNIT_TESTS_ADD_TEST(Buffer);
+  RRLIB_UNIT_TESTS_ADD_TEST(Cached);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void Demangle()
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("int"), util::Demangle(typeid(int).name()));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("std::map<int, double, std::less<int>, std::allocator<std::pair<int const, double> > >"), util::Demangle(typeid(std::map<int, double>).name()));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("not a mangled name"), util::Demangle("not a mangled name"));
+  }
+
+  void Buffer()
+  {
+    tDemangleBuffer buffer;
+    RRLIB_UNIT_TESTS_ASSERT(buffer.Demangle(typeid(int).name()) == "int");
+    RRLIB_UNIT_TESTS_ASSERT(buffer.Demangle(typeid(std::vector<std::vector<std::string>>).name()).find("std::vector<std::vector<std::__cxx11::basic_string<char") == 0);
+    RRLIB_UNIT_TESTS_ASSERT(buffer.Demangle(typeid(TestDemangle).name()) == "rrlib::util::TestDemangle");
+    RRLIB_UNIT_TESTS_ASSERT(buffer.Demangle("_Z") == "_Z");
+  }
+
+  void Cached()
+  {
+    const char* name = typeid(std::map<int, double>).name();
+    std::string_view demangled = DemangleCached(name);
+    RRLIB_UNIT_TESTS_ASSERT(demangled == util::Demangle(name));
+    RRLIB_UNIT_TESTS_ASSERT(DemangleCached(name).data() == demangled.data());
+
+    std::vector<std::thread> threads;
+    std::vector<std::string_view> results(4);
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      threads.emplace_back([&results, i]()
+      {
+        for (int j = 0; j < 1000; j++)
+        {
+          results[i] = DemangleCached(typeid(std::vector<TestDemangle>).name());
+        }
+      });
+    }
+    for (auto & thread : threads)
+    {
+      thread.join();
+    }
+    for (auto & result : results)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(result.data() == results[0].data() && result.find("std::vector<rrlib::util::TestDemangle") == 0);
+    }
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestDemangle);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,295 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/exception.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * Tests backtraces of traceable exceptions.
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <stdexcept>
+#include <string>
+#include <cstdio>
+#include <algorithm>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+
+#include "rrlib/util/tTraceableException.h"
+#include "rrlib/util/exception/tCrashHandler.h"
+#include "rrlib/util/exception/tModuleRegistry.h"
+#include "rrlib/util/exception/tSymbolizer.h"
+#include "rrlib/util/exception/tTraceReporter.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+__attribute__((noinline)) void ThrowTraceableException()
+{
+  throw tTraceableException<std::runtime_error>("test");
+}
+
+__attribute__((noinline)) void Crash(int* volatile address)
+{
+  *address = 42;
+}
+
+class TestException : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestException);
+  RRLIB_UNIT_TESTS_ADD_TEST(Backtrace);
+  RRLIB_UNIT_TESTS_ADD_TEST(Symbolizer);
+  RRLIB_UNIT_TESTS_ADD_TEST(ModuleRegistry);
+  RRLIB_UNIT_TESTS_ADD_TEST(CaptureSettings);
+  RRLIB_UNIT_TESTS_ADD_TEST(TraceReporter);
+  RRLIB_UNIT_TESTS_ADD_TEST(CrashHandler);
+  RRLIB_UNIT_TESTS_ADD_TEST(CrashRecordTruncated);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void Backtrace()
+  {
+    try
+    {
+      ThrowTraceableException();
+      RRLIB_UNIT_TESTS_ASSERT(false);
+    }
+    catch (const tTraceableException<std::runtime_error>& exception)
+    {
+      std::string backtrace = exception.Backtrace();
+#ifndef NDEBUG
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(backtrace, backtrace.find("TestException::Backtrace()") != std::string::npos);
+      RRLIB_UNIT_TESTS_ASSERT_MESSAGE(backtrace, backtrace.find("exception.cpp:") != std::string::npos);
+#endif
+    }
+  }
+
+  void Symbolizer()
+  {
+    auto module = tSymbolizer::Instance().GetModule("/proc/self/exe");
+    RRLIB_UNIT_TESTS_ASSERT(module->IsValid());
+    RRLIB_UNIT_TESTS_ASSERT(module == tSymbolizer::Instance().GetModule("/proc/self/exe"));
+
+    auto invalid_module = tSymbolizer::Instance().GetModule("/nonexistent");
+    tSymbolInfo info;
+    RRLIB_UNIT_TESTS_ASSERT(!invalid_module->IsValid() && !invalid_module->Lookup(0x1000, info));
+  }
+
+  void ModuleRegistry()
+  {
+    auto table = tModuleRegistry::Instance().GetModuleTable();
+    RRLIB_UNIT_TESTS_ASSERT(table == tModuleRegistry::Instance().GetModuleTable());
+    RRLIB_UNIT_TESTS_ASSERT(table->GetModules().size() >= 2);
+
+    char self[1024];
+    ssize_t length = readlink("/proc/self/exe", self, sizeof(self));
+    RRLIB_UNIT_TESTS_ASSERT(length > 0);
+    const tModule* module = table->Find(reinterpret_cast<const void*>(&ThrowTraceableException));
+    RRLIB_UNIT_TESTS_ASSERT(module && module->path == std::string(self, length));
+
+    module = table->Find(reinterpret_cast<const void*>(&fopen));
+    RRLIB_UNIT_TESTS_ASSERT(module && module->path != std::string(self, length) && module->load_bias != 0);
+    RRLIB_UNIT_TESTS_ASSERT(table->Find(nullptr) == nullptr);
+  }
+
+  template <typename TException>
+  static bool Captured()
+  {
+    try
+    {
+      throw TException("test");
+    }
+    catch (const TException& exception)
+    {
+      return std::string(exception.Backtrace()).find("<Backtrace was") == std::string::npos;
+    }
+  }
+
+  void CaptureSettings()
+  {
+#ifndef NDEBUG
+    typedef tTraceableException<std::runtime_error> tRuntimeError;
+    typedef tTraceableException<std::logic_error> tLogicError;
+
+    tTraceableExceptionBase::SetBacktraceMode(tBacktraceMode::FRAME_POINTERS);
+    RRLIB_UNIT_TESTS_ASSERT(Captured<tRuntimeError>());
+    tTraceableExceptionBase::SetBacktraceMode(tBacktraceMode::UNWIND);
+
+    tTraceableExceptionBase::SetBacktraceSampling(4);
+    int captured = 0;
+    for (int i = 0; i < 8; i++)
+    {
+      captured += Captured<tRuntimeError>() ? 1 : 0;
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(2, captured);
+    tTraceableExceptionBase::SetBacktraceSampling(0);
+    RRLIB_UNIT_TESTS_ASSERT(!Captured<tRuntimeError>());
+    tTraceableExceptionBase::SetBacktraceSampling(1);
+
+    tLogicError::EnableBacktrace(false);
+    RRLIB_UNIT_TESTS_ASSERT(!Captured<tLogicError>() && Captured<tRuntimeError>());
+    tLogicError::EnableBacktrace(true);
+    RRLIB_UNIT_TESTS_ASSERT(Captured<tLogicError>());
+#endif
+  }
+
+  template <typename TException>
+  static void Report(const char* message)
+  {
+    try
+    {
+      throw TException(message);
+    }
+    catch (const TException& exception)
+    {
+      tTraceReporter::Instance().Enqueue(exception);
+    }
+  }
+
+  void TraceReporter()
+  {
+#ifndef NDEBUG
+    tTraceReporter& reporter = tTraceReporter::Instance();
+    std::mutex mutex;
+    std::vector<uint64_t> output_counts;
+    reporter.SetOutput([&](const tTraceReport & report)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      output_counts.push_back(report.count);
+    });
+
+    for (int i = 0; i < 12; i++)
+    {
+      Report<tTraceableException<std::runtime_error>>("loop");
+    }
+    Report<tTraceableException<std::logic_error>>("other");
+    reporter.Flush();
+    reporter.SetOutput(nullptr);
+
+    auto reports = reporter.GetReports();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(2), reports.size());
+    std::sort(reports.begin(), reports.end(), [](const tTraceReport & a, const tTraceReport & b)
+    {
+      return a.count > b.count;
+    });
+    RRLIB_UNIT_TESTS_ASSERT(reports[0].count == 12 && reports[0].message == "loop");
+    RRLIB_UNIT_TESTS_ASSERT(reports[1].count == 1 && reports[1].message == "other");
+    RRLIB_UNIT_TESTS_ASSERT(reports[0].backtrace.find("TestException::") != std::string::npos);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(3), output_counts.size());  // 1 and 10 for first trace, 1 for second
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(0), reporter.GetDroppedCount());
+#endif
+  }
+
+  void CrashHandler()
+  {
+    char record_file[] = "/tmp/rrlib_util_crash_record_XXXXXX";
+    int file_descriptor = mkstemp(record_file);
+    RRLIB_UNIT_TESTS_ASSERT(file_descriptor >= 0);
+    close(file_descriptor);
+
+    pid_t child = fork();
+    RRLIB_UNIT_TESTS_ASSERT(child >= 0);
+    if (child == 0)
+    {
+      int null_device = open("/dev/null", O_WRONLY);
+      dup2(null_device, STDERR_FILENO);
+      if (tCrashHandler::Install(record_file))
+      {
+        Crash(nullptr);
+      }
+      _exit(0);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    // previous handler takes over (sanitizers exit with an error code instead of being killed by the signal)
+    RRLIB_UNIT_TESTS_ASSERT((WIFSIGNALED(status) && WTERMSIG(status) == SIGSEGV) || (WIFEXITED(status) && WEXITSTATUS(status) != 0));
+
+    std::ifstream file(record_file);
+    std::stringstream record;
+    record << file.rdbuf();
+    unlink(record_file);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE(record.str(), record.str().find("*** crash record ***\nsignal 11 ") == 0);
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE(record.str(), record.str().find("*** end of crash record ***") != std::string::npos);
+
+    std::string symbolized = tCrashHandler::SymbolizeRecord(record.str());
+#ifndef NDEBUG
+    RRLIB_UNIT_TESTS_ASSERT_MESSAGE(symbolized, symbolized.find("frame 0 ") != std::string::npos && symbolized.find(" in rrlib::util::Crash(int*) at ") != std::string::npos);
+#endif
+  }
+
+  void CrashRecordTruncated()
+  {
+    // records of crashing processes may end in the middle of a frame
+    std::string record = "*** crash record ***\nsignal 11 code 1 address 0x0000000000000000\nframe 0 0x0000000000001000 /usr/bin/app+0x";
+    RRLIB_UNIT_TESTS_EQUALITY(record + "\n", tCrashHandler::SymbolizeRecord(record));
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestException);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,129 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/exception_benchmark.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * Measures the cost of throwing and catching traceable exceptions from
+ * many threads - with stack trace capturing disabled, via backtrace(),
+ * via frame pointer walking and with sampling.
+ * (build without NDEBUG - otherwise stack traces are never captured)
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tTraceableException.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::util;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const int cTHROWS_PER_THREAD = 20000;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+__attribute__((noinline)) void Throw(int depth)
+{
+  if (depth > 0)
+  {
+    Throw(depth - 1);
+    return;
+  }
+  throw tTraceableException<std::runtime_error>("benchmark");
+}
+
+void Measure(const char* name, unsigned int thread_count)
+{
+  std::vector<std::thread> threads;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < thread_count; i++)
+  {
+    threads.emplace_back([]()
+    {
+      for (int j = 0; j < cTHROWS_PER_THREAD; j++)
+      {
+        try
+        {
+          Throw(10);
+        }
+        catch (const std::runtime_error&)
+        {}
+      }
+    });
+  }
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("%-24s %2u threads: %8.2f us per throw/catch (per thread)\n", name, thread_count, seconds * 1000000 / cTHROWS_PER_THREAD);
+}
+
+int main()
+{
+  unsigned int max_threads = std::max(2u, std::thread::hardware_concurrency());
+  for (unsigned int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+  {
+    tTraceableExceptionBase::SetBacktraceSampling(0);
+    Measure("no stack trace", thread_count);
+
+    tTraceableExceptionBase::SetBacktraceSampling(1);
+    tTraceableExceptionBase::SetBacktraceMode(tBacktraceMode::UNWIND);
+    Measure("backtrace()", thread_count);
+
+    tTraceableExceptionBase::SetBacktraceMode(tBacktraceMode::FRAME_POINTERS);
+    Measure("frame pointers", thread_count);
+
+    tTraceableExceptionBase::SetBacktraceMode(tBacktraceMode::UNWIND);
+    tTraceableExceptionBase::SetBacktraceSampling(16);
+    Measure("backtrace() 1 in 16", thread_count);
+  }
+  return 0;
+}
@@ -31,12 +31,14 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <fstream>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/util/tUnitTestSuite.h"
 #include "rrlib/util/fileio.h"
+#include "rrlib/util/tLineReader.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -82,6 +84,7 @@ private:
   {
     TestFileAccess();
     TestDirectoryAccess();
+    TestLineReader();
   }
 
 
@@ -116,6 +119,41 @@ private:
     RRLIB_UNIT_TESTS_ASSERT(!FileExists(absolute_file_name));
   }
 
+  void TestLineReader()
+  {
+    string file_name("");
+    CPPUNIT_ASSERT_NO_THROW(file_name = CreateTempFile());
+    string long_line(5000, 'x');
+    {
+      ofstream file(file_name);
+      file << "first\r\nsecond\n\n" << long_line << "\nlast";
+    }
+
+    std::string_view line;
+    {
+      tLineReader reader(file_name, '\n', 16);
+      vector<string> expected = { "first", "second", "", long_line, "last" };
+      for (auto & expected_line : expected)
+      {
+        RRLIB_UNIT_TESTS_ASSERT(reader.ReadLine(line));
+        RRLIB_UNIT_TESTS_ASSERT(line == expected_line);
+      }
+      RRLIB_UNIT_TESTS_ASSERT(!reader.ReadLine(line));
+      RRLIB_UNIT_TESTS_ASSERT(!reader.ReadLine(line));
+      RRLIB_UNIT_TESTS_EQUALITY(size_t(5), reader.LineNumber());
+    }
+    {
+      tLineReader reader(file_name, 's');
+      RRLIB_UNIT_TESTS_ASSERT(reader.ReadLine(line));
+      RRLIB_UNIT_TESTS_ASSERT(line == "fir");
+      RRLIB_UNIT_TESTS_ASSERT(reader.ReadLine(line));
+      RRLIB_UNIT_TESTS_ASSERT(line == "t\r\n");
+    }
+
+    CPPUNIT_ASSERT_NO_THROW(DeleteFile(file_name));
+    RRLIB_UNIT_TESTS_EXCEPTION(tLineReader reader(file_name), runtime_error);
+  }
+
   void TestDirectoryAccess()
   {
     string temp_dir("");
@@ -0,0 +1,278 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/fstream.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+extern "C"
+{
+#include <unistd.h>
+}
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+#include "rrlib/util/fileio.h"
+#include "rrlib/util/fstream/fileno.h"
+#include "rrlib/util/fstream/tFileDescriptorHandle.h"
+#include "rrlib/util/fstream/tFileDescriptorStreamBuffer.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+namespace test
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+std::string ReadFile(const std::string& file_name)
+{
+  std::ifstream file(file_name);
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+class TestFstream : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestFstream);
+  RRLIB_UNIT_TESTS_ADD_TEST(ReadWrite);
+  RRLIB_UNIT_TESTS_ADD_TEST(Seek);
+  RRLIB_UNIT_TESTS_ADD_TEST(WriteToReadOnly);
+  RRLIB_UNIT_TESTS_ADD_TEST(Copy);
+  RRLIB_UNIT_TESTS_ADD_TEST(FileDescriptorLookup);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  std::string large_block = std::string(5000, 'x') + "y";
+
+  /*! Writes test content to 'file_name' using a small buffer (so that small and large writes are tested) */
+  std::string WriteTestFile()
+  {
+    std::string file_name = fileio::CreateTempFile();
+    tFileDescriptorStreamBuffer buffer(file_name, std::ios_base::out, 64);
+    std::ostream stream(&buffer);
+    stream << "first line\n" << 42 << '\n';
+    stream.write(large_block.data(), large_block.size());
+    stream << "\nlast line\n";
+    RRLIB_UNIT_TESTS_ASSERT(stream.good());
+    return file_name;
+  }
+
+  void ReadWrite()
+  {
+    std::string file_name = WriteTestFile();
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("first line\n42\n") + large_block + "\nlast line\n", ReadFile(file_name));
+
+    tFileDescriptorStreamBuffer buffer(file_name, std::ios_base::in, 64);
+    std::istream stream(&buffer);
+    std::string line;
+    int number = 0;
+    std::getline(stream, line);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("first line"), line);
+    stream >> number;
+    RRLIB_UNIT_TESTS_EQUALITY(42, number);
+    stream.get();
+    std::string block(large_block.size(), ' ');
+    stream.read(&block[0], block.size());
+    RRLIB_UNIT_TESTS_ASSERT(block == large_block);
+    stream.get();
+    std::getline(stream, line);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("last line"), line);
+    RRLIB_UNIT_TESTS_ASSERT(!std::getline(stream, line));
+
+    RRLIB_UNIT_TESTS_EQUALITY(buffer.FileDescriptor(), GetFileDescriptor(static_cast<std::streambuf*>(&buffer)));
+    fileio::DeleteFile(file_name);
+  }
+
+  void Seek()
+  {
+    std::string file_name = WriteTestFile();
+    tFileDescriptorStreamBuffer buffer(file_name, std::ios_base::in | std::ios_base::out, 64);
+    std::iostream stream(&buffer);
+    std::string word;
+    stream >> word;
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("first"), word);
+    RRLIB_UNIT_TESTS_EQUALITY(std::streamoff(5), std::streamoff(stream.tellg()));
+
+    // writing after reading continues at the logical read position
+    stream << "-LINE";
+    stream.flush();
+    stream.seekg(0);
+    std::getline(stream, word);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("first-LINE"), word);
+
+    stream.seekg(-10, std::ios_base::end);
+    std::getline(stream, word);
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("last line"), word);
+    fileio::DeleteFile(file_name);
+  }
+
+  void WriteToReadOnly()
+  {
+    int pipe_fds[2];
+    RRLIB_UNIT_TESTS_ASSERT(pipe(pipe_fds) == 0);
+    {
+      tFileDescriptorStreamBuffer buffer(pipe_fds[1], std::ios_base::in);
+      std::ostream stream(&buffer);
+      stream << "hello world";
+      RRLIB_UNIT_TESTS_ASSERT(!stream.good());
+      stream.clear();
+      stream.put('x');
+      RRLIB_UNIT_TESTS_ASSERT(!stream.good());
+      RRLIB_UNIT_TESTS_EQUALITY(0, buffer.pubsync());
+    }
+    close(pipe_fds[1]);
+    {
+      tFileDescriptorStreamBuffer source(pipe_fds[0], std::ios_base::in);
+      RRLIB_UNIT_TESTS_ASSERT(std::istream(&source).get() == std::char_traits<char>::eof());
+    }
+    close(pipe_fds[0]);
+  }
+
+  void Copy()
+  {
+    std::string file_name = WriteTestFile();
+    std::string content = ReadFile(file_name);
+    std::string copy_name = fileio::CreateTempFile();
+
+    // file to file (sendfile) - with some data already read ahead by the source
+    {
+      tFileDescriptorStreamBuffer source(file_name, std::ios_base::in, 64);
+      tFileDescriptorStreamBuffer destination(copy_name, std::ios_base::out, 64);
+      std::istream input(&source);
+      std::ostream output(&destination);
+      std::string line;
+      std::getline(input, line);
+      output << line << '|';
+      RRLIB_UNIT_TESTS_EQUALITY(std::streamsize(content.size() - line.size() - 1), CopyStreamBuffer(source, destination));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY("first line|" + content.substr(11), ReadFile(copy_name));
+
+    // file to pipe (splice) and back to a standard stream buffer (user space copy)
+    int pipe_fds[2];
+    RRLIB_UNIT_TESTS_ASSERT(pipe(pipe_fds) == 0);
+    {
+      tFileDescriptorStreamBuffer source(file_name, std::ios_base::in);
+      tFileDescriptorStreamBuffer destination(pipe_fds[1], std::ios_base::out);
+      RRLIB_UNIT_TESTS_EQUALITY(std::streamsize(100), CopyStreamBuffer(source, destination, 100));
+    }
+    close(pipe_fds[1]);
+    {
+      tFileDescriptorStreamBuffer source(pipe_fds[0], std::ios_base::in);
+      std::stringbuf destination;
+      RRLIB_UNIT_TESTS_EQUALITY(std::streamsize(100), CopyStreamBuffer(source, destination));
+      RRLIB_UNIT_TESTS_EQUALITY(content.substr(0, 100), destination.str());
+    }
+    close(pipe_fds[0]);
+    fileio::DeleteFile(copy_name);
+    fileio::DeleteFile(file_name);
+  }
+
+  void FileDescriptorLookup()
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(2, GetCachedFileDescriptor(std::cerr.rdbuf()));
+    RRLIB_UNIT_TESTS_EQUALITY(2, GetCachedFileDescriptor(std::cerr.rdbuf()));
+    std::stringbuf string_buffer;
+    RRLIB_UNIT_TESTS_EQUALITY(-1, GetCachedFileDescriptor(static_cast<std::streambuf*>(&string_buffer)));
+
+    std::string file_name = WriteTestFile();
+    {
+      std::ifstream file(file_name);
+      int file_descriptor = GetCachedFileDescriptor(file.rdbuf());
+      RRLIB_UNIT_TESTS_ASSERT(file_descriptor > 2);
+      tFileDescriptorHandle handle(file.rdbuf());
+      RRLIB_UNIT_TESTS_EQUALITY(file_descriptor, handle.FileDescriptor());
+      RRLIB_UNIT_TESTS_ASSERT(handle.IsValid() && handle.Type() == tFileType::REGULAR);
+      RRLIB_UNIT_TESTS_ASSERT(!handle.IsTerminal());
+      RRLIB_UNIT_TESTS_EQUALITY(size_t(0), handle.PipeCapacity());
+
+      // file stream is reopened: cached descriptor is stale until invalidated
+      file.close();
+      int other_fd = open("/dev/null", O_RDONLY);
+      file.open(file_name);
+      RRLIB_UNIT_TESTS_EQUALITY(file_descriptor, GetCachedFileDescriptor(file.rdbuf()));
+      InvalidateFileDescriptorCache();
+      RRLIB_UNIT_TESTS_EQUALITY(GetFileDescriptor(file.rdbuf()), GetCachedFileDescriptor(file.rdbuf()));
+      close(other_fd);
+    }
+    fileio::DeleteFile(file_name);
+
+    int pipe_fds[2];
+    RRLIB_UNIT_TESTS_ASSERT(pipe(pipe_fds) == 0);
+    tFileDescriptorHandle handle(pipe_fds[1]);
+    RRLIB_UNIT_TESTS_ASSERT(handle.Type() == tFileType::PIPE);
+    RRLIB_UNIT_TESTS_ASSERT(handle.PipeCapacity() >= 4096);
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+
+    RRLIB_UNIT_TESTS_ASSERT(!tFileDescriptorHandle(-1).IsValid());
+    RRLIB_UNIT_TESTS_ASSERT(tFileDescriptorHandle(static_cast<std::streambuf*>(&string_buffer)).Type() == tFileType::UNKNOWN);
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestFstream);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -31,12 +31,14 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <random>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/util/tUnitTestSuite.h"
 #include "rrlib/util/string.h"
+#include "rrlib/util/tStringIndex.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -73,6 +75,8 @@ class TestString : public util::tUnitTestSuite
 {
   RRLIB_UNIT_TESTS_BEGIN_SUITE(TestString);
   RRLIB_UNIT_TESTS_ADD_TEST(TestFunctions);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestStringIndex);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestIgnoreCase);
   RRLIB_UNIT_TESTS_END_SUITE;
 
 private:
@@ -85,6 +89,9 @@ private:
     TestStartsWith("string", " string", false);
     TestStartsWith("string ", "string", true);
     TestStartsWith("string", "string ", false);
+    TestStartsWith("str", "string", false);
+    RRLIB_UNIT_TESTS_ASSERT(!StartsWith("a", std::string_view("a\0b", 3)));
+    RRLIB_UNIT_TESTS_ASSERT(StartsWith(std::string("a\0bc", 4), std::string_view("a\0b", 3)));
 
     TestEndsWith("", "", true);
     TestEndsWith("same string", "same string", true);
@@ -124,6 +131,101 @@ private:
     RRLIB_UNIT_TESTS_ASSERT(expected == tokens);
   }
 
+  virtual void TestStringIndex()
+  {
+    const char* names[] = { "eRED", "eGREEN", "eBLUE", "", "eGREEN", "eBLUE_" };
+    tStringIndex index(names, 6);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(6), index.Size());
+    RRLIB_UNIT_TESTS_EQUALITY(0, index.Find("eRED"));
+    RRLIB_UNIT_TESTS_EQUALITY(1, index.Find(std::string("eGREEN")));
+    RRLIB_UNIT_TESTS_EQUALITY(2, index.Find("eBLUE"));
+    RRLIB_UNIT_TESTS_EQUALITY(3, index.Find(""));
+    RRLIB_UNIT_TESTS_EQUALITY(5, index.Find("eBLUE_"));
+    RRLIB_UNIT_TESTS_EQUALITY(2, index.Find("eBLUE_", 5));
+    RRLIB_UNIT_TESTS_EQUALITY(-1, index.Find("eblue"));
+    RRLIB_UNIT_TESTS_EQUALITY(-1, index.Find("eYELLOW"));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("eBLUE"), index.GetString(2));
+    RRLIB_UNIT_TESTS_EQUALITY(-1, tStringIndex().Find("eRED"));
+
+    std::vector<std::string> many_names;
+    for (int i = 0; i < 1000; i++)
+    {
+      many_names.push_back("parameter" + std::to_string(i));
+    }
+    tStringIndex large_index(many_names.begin(), many_names.end());
+    for (int i = 0; i < 1000; i++)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(i, large_index.Find(many_names[i]));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(-1, large_index.Find("parameter1000"));
+  }
+
+  virtual void TestIgnoreCase()
+  {
+    RRLIB_UNIT_TESTS_ASSERT(EqualsIgnoreCase("", ""));
+    RRLIB_UNIT_TESTS_ASSERT(EqualsIgnoreCase("Parameter", "pARAMETER"));
+    RRLIB_UNIT_TESTS_ASSERT(!EqualsIgnoreCase("Parameter", "Parameters"));
+    RRLIB_UNIT_TESTS_ASSERT(!EqualsIgnoreCase("[", "{"));
+    RRLIB_UNIT_TESTS_ASSERT(!EqualsIgnoreCase("\xC4", "\xE4"));
+    RRLIB_UNIT_TESTS_ASSERT(CompareIgnoreCase("abc", "ABD") < 0);
+    RRLIB_UNIT_TESTS_ASSERT(CompareIgnoreCase("abc", "AB") > 0);
+    RRLIB_UNIT_TESTS_ASSERT(CompareIgnoreCase("Z", "\xE4") < 0);
+    RRLIB_UNIT_TESTS_ASSERT(StartsWithIgnoreCase("Content-Length: 5", "content-length"));
+    RRLIB_UNIT_TESTS_ASSERT(!StartsWithIgnoreCase("Content", "content-length"));
+    RRLIB_UNIT_TESTS_ASSERT(EndsWithIgnoreCase("image.PNG", ".png"));
+    RRLIB_UNIT_TESTS_ASSERT(!EndsWithIgnoreCase("png", ".png"));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(4), FindIgnoreCase("The QUICK brown fox", "quick"));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), FindIgnoreCase("abc", ""));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), FindIgnoreCase("abc", "", 3));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string::npos, FindIgnoreCase("abc", "", 4));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string::npos, FindIgnoreCase("The QUICK brown fox", "quick", 5));
+
+    // compare with straightforward implementation for strings of different lengths (exercises vectorized code paths)
+    std::mt19937 random_engine(4711);
+    const char cCHARACTERS[] = "aAbBzZ@[`{09_\xE4\xC4";
+    auto random_string = [&](size_t length)
+    {
+      std::string result;
+      for (size_t i = 0; i < length; i++)
+      {
+        result += cCHARACTERS[random_engine() % (sizeof(cCHARACTERS) - 1)];
+      }
+      return result;
+    };
+    auto to_lower = [](std::string string)
+    {
+      for (char & c : string)
+      {
+        c = (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+      }
+      return string;
+    };
+    for (size_t i = 0; i < 2000; i++)
+    {
+      std::string string1 = random_string(random_engine() % 70);
+      std::string string2 = (i % 2) ? random_string(random_engine() % 70) : string1;
+      if (i % 4 == 0 && string2.length())
+      {
+        string2[random_engine() % string2.length()] ^= 0x20;
+      }
+      int expected = to_lower(string1).compare(to_lower(string2));
+      int result = CompareIgnoreCase(string1, string2);
+      RRLIB_UNIT_TESTS_ASSERT((expected < 0 && result < 0) || (expected == 0 && result == 0) || (expected > 0 && result > 0));
+      RRLIB_UNIT_TESTS_EQUALITY(expected == 0, EqualsIgnoreCase(string1, string2));
+      if (expected == 0)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY(HashIgnoreCase(string1), HashIgnoreCase(string2));
+      }
+
+      std::string substring = string1.substr(string1.length() / 3, random_engine() % 20);
+      if (i % 3 == 0)
+      {
+        substring = random_string(1 + random_engine() % 3);
+      }
+      RRLIB_UNIT_TESTS_EQUALITY(to_lower(string1).find(to_lower(substring)), FindIgnoreCase(string1, substring));
+    }
+  }
+
   void TestStartsWith(const char* string, const char* prefix, bool expected_result)
   {
     std::string message = std::string("StartsWith(\"") + string + "\", \"" + prefix + "\") must return " + std::to_string(expected_result) + ".";
@@ -131,6 +233,7 @@ private:
     RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("(2): " + message, expected_result, StartsWith(std::string(string), prefix));
     RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("(3): " + message, expected_result, StartsWith(string, std::string(prefix)));
     RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("(4): " + message, expected_result, StartsWith(std::string(string), std::string(prefix)));
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("(5): " + message, expected_result, StartsWith(std::string_view(string), std::string_view(prefix)));
   }
 
   void TestEndsWith(const char* string, const char* suffix, bool expected_result)
@@ -140,6 +243,7 @@ private:
     RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("(2): " + message, expected_result, EndsWith(std::string(string), suffix));
     RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("(3): " + message, expected_result, EndsWith(string, std::string(suffix)));
     RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("(4): " + message, expected_result, EndsWith(std::string(string), std::string(suffix)));
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("(5): " + message, expected_result, EndsWith(std::string_view(string), std::string_view(suffix)));
   }
 
   void TestTrimWhitespace(const char* string, const char* expected_result)
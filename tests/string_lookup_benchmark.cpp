@@ -0,0 +1,147 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/string_lookup_benchmark.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-19
+ *
+ * Compares the cost of looking up strings in a fixed table with
+ * - a linear search using strcmp
+ * - std::unordered_map
+ * - tStringIndex
+ * - tStringSwitch
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tStringIndex.h"
+#include "rrlib/util/tStringSwitch.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::util;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+constexpr const char* cKEYS[] =
+{
+  "connect", "disconnect", "subscribe", "unsubscribe", "publish", "get_parameter", "set_parameter", "list_ports",
+  "create_port", "delete_port", "start_executing", "pause_executing", "get_structure", "set_structure", "ping", "pong",
+  "get_runtime_info", "get_type_info", "register_type", "unregister_type", "set_log_level", "get_log_level", "shutdown", "restart"
+};
+constexpr size_t cKEY_COUNT = sizeof(cKEYS) / sizeof(cKEYS[0]);
+constexpr auto cKEY_SWITCH = MakeStringSwitch(cKEYS);
+
+const size_t cQUERY_COUNT = 1024;
+const size_t cREPETITIONS = 2000;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+template <typename TFunction>
+void Measure(const char* name, const std::vector<std::string>& queries, TFunction lookup)
+{
+  int checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t repetition = 0; repetition < cREPETITIONS; repetition++)
+  {
+    for (const std::string & query : queries)
+    {
+      checksum += lookup(query);
+    }
+  }
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  printf("%-16s %8.2f ns/lookup  (checksum %d)\n", name, static_cast<double>(duration.count()) / (cREPETITIONS * queries.size()), checksum);
+}
+
+int main()
+{
+  // 3/4 of queries hit, 1/4 miss
+  std::vector<std::string> queries;
+  std::mt19937 random_engine(42);
+  for (size_t i = 0; i < cQUERY_COUNT; i++)
+  {
+    std::string key = cKEYS[random_engine() % cKEY_COUNT];
+    queries.push_back((i % 4 == 3) ? key + "_x" : key);
+  }
+
+  std::unordered_map<std::string, int> map;
+  for (size_t i = 0; i < cKEY_COUNT; i++)
+  {
+    map.emplace(cKEYS[i], static_cast<int>(i));
+  }
+  tStringIndex index(cKEYS, cKEY_COUNT);
+
+  printf("Looking up %zu strings in a table with %zu entries (%zu repetitions)\n", queries.size(), cKEY_COUNT, cREPETITIONS);
+  Measure("linear strcmp", queries, [](const std::string & query)
+  {
+    for (size_t i = 0; i < cKEY_COUNT; i++)
+    {
+      if (strcmp(cKEYS[i], query.c_str()) == 0)
+      {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  });
+  Measure("unordered_map", queries, [&map](const std::string & query)
+  {
+    auto it = map.find(query);
+    return it != map.end() ? it->second : -1;
+  });
+  Measure("tStringIndex", queries, [&index](const std::string & query)
+  {
+    return index.Find(query);
+  });
+  Measure("tStringSwitch", queries, [](const std::string & query)
+  {
+    return cKEY_SWITCH.Find(query);
+  });
+
+  return 0;
+}
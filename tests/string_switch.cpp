@@ -0,0 +1,115 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/string_switch.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-19
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+#include "rrlib/util/tStringSwitch.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+namespace test
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+enum class tCommand { START, STOP, RESET, UNKNOWN };
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+constexpr auto cCOMMANDS = MakeStringSwitch("start", "stop", "reset");
+
+constexpr const char* cNAMES[] = { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta", "iota", "kappa", "lambda", "mu", "nu", "xi", "omicron", "pi", "rho", "sigma", "tau", "upsilon", "phi", "chi", "psi", "omega" };
+constexpr auto cNAME_SWITCH = MakeStringSwitch(cNAMES);
+
+static_assert(cCOMMANDS.Find("stop") == 1, "Lookup must be possible at compile time");
+static_assert(cCOMMANDS.Find("stop ") == -1, "Lookup must be possible at compile time");
+static_assert(cNAME_SWITCH.Find("omega") == 23, "Lookup must be possible at compile time");
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestStringSwitch : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestStringSwitch);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestLookup);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  virtual void TestLookup()
+  {
+    RRLIB_UNIT_TESTS_ASSERT(tCommand::START == cCOMMANDS.Find(std::string("start"), tCommand::UNKNOWN));
+    RRLIB_UNIT_TESTS_ASSERT(tCommand::RESET == cCOMMANDS.Find("reset", tCommand::UNKNOWN));
+    RRLIB_UNIT_TESTS_ASSERT(tCommand::UNKNOWN == cCOMMANDS.Find("Start", tCommand::UNKNOWN));
+    RRLIB_UNIT_TESTS_ASSERT(tCommand::UNKNOWN == cCOMMANDS.Find("", tCommand::UNKNOWN));
+
+    for (size_t i = 0; i < cNAME_SWITCH.Size(); i++)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(static_cast<int>(i), cNAME_SWITCH.Find(cNAMES[i]));
+      RRLIB_UNIT_TESTS_EQUALITY(-1, cNAME_SWITCH.Find(std::string(cNAMES[i]) + "_"));
+      RRLIB_UNIT_TESTS_ASSERT(cNAME_SWITCH.GetString(i) == cNAMES[i]);
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(-1, MakeStringSwitch().Find("alpha"));
+    RRLIB_UNIT_TESTS_EQUALITY(0, MakeStringSwitch("").Find(""));
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestStringSwitch);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -32,7 +32,20 @@
 //----------------------------------------------------------------------
 #include "rrlib/util/tUnitTestSuite.h"
 
+#include <cmath>
+#include <random>
+#include <thread>
+
 #include "rrlib/util/tTime.h"
+#include "rrlib/util/tCPUTimeAccount.h"
+#include "rrlib/util/tClockSynchronization.h"
+#include "rrlib/util/tConcurrentFPSComputer.h"
+#include "rrlib/util/tFPSComputer.h"
+#include "rrlib/util/tFrameTimeMonitor.h"
+#include "rrlib/util/tPeriodicLoop.h"
+#include "rrlib/util/tTimerWheel.h"
+#include "rrlib/util/tTransformTime.h"
+#include "rrlib/util/tTimeFormatter.h"
 #include "rrlib/time/time.h"
 
 //----------------------------------------------------------------------
@@ -71,6 +84,17 @@ class TestTime : public util::tUnitTestSuite
 {
   RRLIB_UNIT_TESTS_BEGIN_SUITE(TestTime);
   RRLIB_UNIT_TESTS_ADD_TEST(Conversion);
+  RRLIB_UNIT_TESTS_ADD_TEST(Arithmetic);
+  RRLIB_UNIT_TESTS_ADD_TEST(CompileTime);
+  RRLIB_UNIT_TESTS_ADD_TEST(ClockSources);
+  RRLIB_UNIT_TESTS_ADD_TEST(Formatting);
+  RRLIB_UNIT_TESTS_ADD_TEST(CPUTime);
+  RRLIB_UNIT_TESTS_ADD_TEST(PeriodicLoop);
+  RRLIB_UNIT_TESTS_ADD_TEST(TimerWheel);
+  RRLIB_UNIT_TESTS_ADD_TEST(Histogram);
+  RRLIB_UNIT_TESTS_ADD_TEST(FrameStatistics);
+  RRLIB_UNIT_TESTS_ADD_TEST(ConcurrentFPS);
+  RRLIB_UNIT_TESTS_ADD_TEST(ClockSynchronization);
   RRLIB_UNIT_TESTS_END_SUITE;
 
 private:
@@ -81,6 +105,452 @@ private:
     RRLIB_UNIT_TESTS_EQUALITY(rrlib::util::tTime(100000, 500), rrlib::util::tTime(now));
   }
 
+  void Arithmetic()
+  {
+    // nanosecond resolution is preserved in conversions
+    auto timestamp = rrlib::time::tTimestamp() + std::chrono::seconds(100000) + std::chrono::nanoseconds(123456789);
+    tTime time(timestamp);
+    RRLIB_UNIT_TESTS_EQUALITY(100000123456789LL, time.ToNSec());
+    RRLIB_UNIT_TESTS_ASSERT(timestamp == static_cast<rrlib::time::tTimestamp>(time));
+    timespec spec = time;
+    RRLIB_UNIT_TESTS_EQUALITY(100000L, static_cast<long>(spec.tv_sec));
+    RRLIB_UNIT_TESTS_EQUALITY(123456789L, static_cast<long>(spec.tv_nsec));
+    RRLIB_UNIT_TESTS_EQUALITY(time, tTime(spec));
+    timeval val = time;
+    RRLIB_UNIT_TESTS_EQUALITY(123456L, static_cast<long>(val.tv_usec));
+
+    // negative times: subsecond part is positive (as with the normalized timeval representation)
+    tTime negative = tTime().FromMSec(-1500);
+    RRLIB_UNIT_TESTS_EQUALITY(-2L, negative.TvSec());
+    RRLIB_UNIT_TESTS_EQUALITY(500000L, negative.TvUSec());
+    RRLIB_UNIT_TESTS_EQUALITY(-1500LL, negative.ToMSec());
+    RRLIB_UNIT_TESTS_EQUALITY(tTime(-2, 500000), negative);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime(1, 500000), -negative);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime(0, 0), negative + tTime(1, 500000));
+    RRLIB_UNIT_TESTS_EQUALITY(-1LL, tTime().FromNSec(-1).ToUSec());
+
+    RRLIB_UNIT_TESTS_EQUALITY(tTime(3, 0), tTime::time_500ms * 6);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime(0, 250000), tTime::time_500ms * 0.5);
+    RRLIB_UNIT_TESTS_ASSERT(tTime::time_1ms < tTime::time_5ms && tTime::time_forever < tTime::time_0ms);
+  }
+
+  void CompileTime()
+  {
+    using namespace time_literals;
+    static_assert(tTime::time_1ms * 5 == tTime::time_5ms, "");
+    static_assert(5_ms == tTime::time_5ms && 1_s == tTime::time_1s && 1_us == tTime::time_1us, "");
+    static_assert(1500_ms == 1.5_s && 2_min == 120_s && 1_h == tTime(3600, 0) && 10_ns < 1_us, "");
+    static_assert((1_s - 250_ms).ToUSec() == 750000, "");
+    static_assert((-1500_ms).TvSec() == -2 && (-1500_ms).TvUSec() == 500000, "");
+    constexpr tTime cDEADLINE = tTime(100, 0) + tTime::time_500ms;
+    static_assert(cDEADLINE.ToMSec() == 100500 && cDEADLINE.MSeconds() == 500, "");
+    RRLIB_UNIT_TESTS_EQUALITY(tTime(0, 2500), 2.5_ms);
+  }
+
+  void ClockSources()
+  {
+    tTime::InitializeClock(tClockSource::TSC);
+    const tClockSource cMONOTONIC_SOURCES[] = { tClockSource::MONOTONIC, tClockSource::MONOTONIC_COARSE, tClockSource::TSC };
+    for (tClockSource source : cMONOTONIC_SOURCES)
+    {
+      tTime last = tTime::Now(source);
+      for (int i = 0; i < 1000; i++)
+      {
+        tTime now = tTime::Now(source);
+        RRLIB_UNIT_TESTS_ASSERT(now >= last);
+        last = now;
+      }
+    }
+
+    // TSC stays monotonic and close to CLOCK_MONOTONIC when it is re-anchored
+    tTime tsc_start = tTime::Now(tClockSource::TSC);
+    tTime tsc_last = tsc_start;
+    while (tsc_last - tsc_start < 1200_ms)
+    {
+      tTime tsc = tTime::Now(tClockSource::TSC);
+      RRLIB_UNIT_TESTS_ASSERT(tsc >= tsc_last);
+      RRLIB_UNIT_TESTS_ASSERT((tsc - tTime::Now(tClockSource::MONOTONIC)).ToUSec() < 1000);
+      tsc_last = tsc;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // monotonic sources share the same time base
+    tTime monotonic = tTime::Now(tClockSource::MONOTONIC);
+    RRLIB_UNIT_TESTS_ASSERT(tTime::Now(tClockSource::TSC) - monotonic < tTime::time_10ms);
+    RRLIB_UNIT_TESTS_ASSERT(tTime::Now(tClockSource::TSC) >= monotonic);
+    RRLIB_UNIT_TESTS_ASSERT(tTime::Now(tClockSource::MONOTONIC_COARSE) - monotonic < tTime::time_100ms);
+
+    tTime future = tTime::FutureMSec(50, tClockSource::MONOTONIC);
+    RRLIB_UNIT_TESTS_ASSERT(future - monotonic >= tTime::time_50ms);
+    RRLIB_UNIT_TESTS_ASSERT(future - monotonic < tTime::time_1s);
+  }
+
+  void Formatting()
+  {
+    tTime time(1234567890, 12345);
+    tTimeFormatter formatter("%Y-%m-%d %H:%M:%S.%3N");
+    RRLIB_UNIT_TESTS_EQUALITY(time.GetString("%Y-%m-%d %H:%M:%S") + ".012", formatter.Format(time));
+    RRLIB_UNIT_TESTS_EQUALITY(time.GetString("%Y-%m-%d %H:%M:%S") + ".999", formatter.Format(time + tTime(0, 987000)));
+    RRLIB_UNIT_TESTS_EQUALITY(time.GetString("%Y-%m-%d %H:%M:%S") + ".000", formatter.Format(time - tTime(0, 12345)));
+    RRLIB_UNIT_TESTS_EQUALITY((time + tTime::time_1s).GetString("%Y-%m-%d %H:%M:%S") + ".012", formatter.Format(time + tTime::time_1s));
+
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("[012345000 s 100%]"), tTimeFormatter("[%N s 100%%]").Format(time));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("09-0123 09"), tTimeFormatter("%y-%4N %y").Format(time));
+    RRLIB_UNIT_TESTS_EQUALITY(time.GetString("%H:%M"), tTimeFormatter("%H:%M").Format(time));
+
+    char buffer[8];
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), tTimeFormatter("%H:%M:%S.%6N").Format(time, buffer, sizeof(buffer)));
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(7), tTimeFormatter("%y.%4N").Format(time, buffer, sizeof(buffer)));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("09.0123"), std::string(buffer));
+
+    std::string longest(tTimeFormatter::cMAX_LENGTH - 1, 'x');
+    char large_buffer[tTimeFormatter::cMAX_FORMATTED_LENGTH];
+    RRLIB_UNIT_TESTS_EQUALITY(2 * longest.length() + 9, tTimeFormatter(longest + "%N" + longest).Format(time, large_buffer, sizeof(large_buffer)));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("012345000") + longest, tTimeFormatter(longest + "x%N" + longest).Format(time));
+  }
+
+  static void BusyWait(const tTime& cpu_time)
+  {
+    tTime start = tTime::TaskTime();
+    while (tTime::TaskTime() - start < cpu_time)
+    {}
+  }
+
+  void CPUTime()
+  {
+    // sleeping does not consume CPU time
+    tTime start = tTime::TaskTime();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    RRLIB_UNIT_TESTS_ASSERT(tTime::TaskTime() - start < tTime::time_10ms);
+
+    static tCPUTimeAccount cOUTER("outer"), cINNER("inner");
+    {
+      tScopedCPUTime outer(cOUTER);
+      BusyWait(tTime::time_10ms);
+      for (int i = 0; i < 2; i++)
+      {
+        tScopedCPUTime inner(cINNER);
+        BusyWait(tTime::time_5ms);
+      }
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(1), cOUTER.GetThreadCount());
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(2), cINNER.GetThreadCount());
+    RRLIB_UNIT_TESTS_ASSERT(cOUTER.GetThreadCPUTime() >= tTime::time_20ms && cOUTER.GetThreadCPUTime() < tTime::time_50ms);
+    RRLIB_UNIT_TESTS_ASSERT(cINNER.GetThreadCPUTime() >= tTime::time_10ms && cINNER.GetThreadCPUTime() < cOUTER.GetThreadCPUTime());
+
+    // other thread's CPU time is booked separately
+    std::thread worker([]()
+    {
+      tScopedCPUTime inner(cINNER);
+      BusyWait(tTime::time_5ms);
+    });
+    worker.join();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(2), cINNER.GetThreadCount());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("inner"), cINNER.GetName());
+
+    // terminated threads are summed up in a single entry
+    for (int i = 0; i < 20; i++)
+    {
+      std::thread([]()
+      {
+        cINNER.Book(tTime::time_1ms);
+      }).join();
+    }
+    size_t inner_entries = 0;
+    for (const tCPUTimeUsage& usage : GetCPUTimeUsage())
+    {
+      if (usage.account_name == "inner")
+      {
+        inner_entries++;
+        RRLIB_UNIT_TESTS_ASSERT(usage.cpu_time >= tTime::time_5ms);
+        if (usage.thread_id == 0)
+        {
+          RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(21), usage.count);
+        }
+      }
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(2), inner_entries);
+  }
+
+  void PeriodicLoop()
+  {
+    using namespace time_literals;
+
+    // no drift: deadlines are multiples of the period (cycles may be skipped if this thread is preempted)
+    tPeriodicLoop loop(2_ms, tOverrunPolicy::SKIP, tTime(0, 100));
+    tTime start = loop.GetDeadline();
+    uint64_t skipped = 0;
+    for (int i = 1; i <= 20; i++)
+    {
+      skipped += loop.WaitForNextCycle();
+      RRLIB_UNIT_TESTS_EQUALITY(start + 2_ms * (i + skipped), loop.GetDeadline());
+      RRLIB_UNIT_TESTS_ASSERT(tTime::Now(tClockSource::MONOTONIC) >= loop.GetDeadline());
+    }
+    tPeriodicLoopStatistics statistics = loop.GetStatistics();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(20), statistics.cycles);
+    RRLIB_UNIT_TESTS_EQUALITY(skipped, statistics.skipped_cycles);
+    RRLIB_UNIT_TESTS_ASSERT(statistics.min_latency >= tTime::time_0ms && statistics.min_latency <= statistics.mean_latency && statistics.mean_latency <= statistics.max_latency);
+
+    // overrun with SKIP: continue with next deadline in the future
+    loop.ResetStatistics();
+    tTime deadline = loop.GetDeadline();
+    std::this_thread::sleep_for(std::chrono::microseconds(7000));
+    skipped = loop.WaitForNextCycle();
+    RRLIB_UNIT_TESTS_ASSERT(skipped >= 3);
+    RRLIB_UNIT_TESTS_EQUALITY(deadline + 2_ms * (skipped + 1), loop.GetDeadline());
+    statistics = loop.GetStatistics();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(1), statistics.overruns);
+    RRLIB_UNIT_TESTS_EQUALITY(skipped, statistics.skipped_cycles);
+    RRLIB_UNIT_TESTS_ASSERT(statistics.max_execution_time >= tTime(0, 7000));
+
+    // statistics reset in the middle of a cycle: mean execution time covers all cycles finished since
+    tPeriodicLoop work_loop(5_ms);
+    work_loop.WaitForNextCycle();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    work_loop.ResetStatistics();
+    for (int i = 0; i < 4; i++)
+    {
+      work_loop.WaitForNextCycle();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    work_loop.WaitForNextCycle();
+    statistics = work_loop.GetStatistics();
+    RRLIB_UNIT_TESTS_ASSERT(statistics.mean_execution_time >= 1_ms);
+    RRLIB_UNIT_TESTS_ASSERT(statistics.mean_execution_time <= statistics.max_execution_time);
+    tTime mean_execution_time = statistics.mean_execution_time;
+    work_loop.Restart();
+    work_loop.WaitForNextCycle();
+    RRLIB_UNIT_TESTS_EQUALITY(mean_execution_time, work_loop.GetStatistics().mean_execution_time);
+
+    // overrun with CATCH_UP: missed cycles start immediately
+    tPeriodicLoop catch_up_loop(tTime::time_20ms, tOverrunPolicy::CATCH_UP);
+    start = catch_up_loop.GetDeadline();
+    catch_up_loop.WaitForNextCycle();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    tTime before = tTime::Now(tClockSource::MONOTONIC);
+    catch_up_loop.WaitForNextCycle();
+    catch_up_loop.WaitForNextCycle();
+    RRLIB_UNIT_TESTS_ASSERT(tTime::Now(tClockSource::MONOTONIC) - before < tTime::time_10ms);
+    RRLIB_UNIT_TESTS_EQUALITY(start + tTime::time_20ms * 3, catch_up_loop.GetDeadline());
+    catch_up_loop.WaitForNextCycle();
+    RRLIB_UNIT_TESTS_ASSERT(tTime::Now(tClockSource::MONOTONIC) >= start + tTime::time_20ms * 4);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(2), catch_up_loop.GetStatistics().overruns);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(4), catch_up_loop.GetStatistics().cycles);
+  }
+
+  void TimerWheel()
+  {
+    tTimerWheel wheel(tTime::time_1us);
+    const tTime start = wheel.GetCurrentTime();
+
+    // timers fire in the first Advance() at or after their deadline (compared to brute force reference)
+    const size_t cTIMERS = 5000;
+    std::mt19937 random(42);
+    std::vector<tTime> deadlines(cTIMERS);
+    std::vector<tTime> fired(cTIMERS);
+    std::vector<tTimerWheel::tTimerId> ids(cTIMERS);
+    tTime now = start;
+    for (size_t i = 0; i < cTIMERS; i++)
+    {
+      long long range_nsec = (i % 3 == 0) ? 200000LL : ((i % 3 == 1) ? 20000000LL : 2000000000LL);
+      deadlines[i] = start + tTime().FromNSec(std::uniform_int_distribution<long long>(0, range_nsec)(random));
+      ids[i] = wheel.AddTimer(deadlines[i], [&fired, &now, i]()
+      {
+        fired[i] = now;
+      });
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(cTIMERS, wheel.Size());
+    size_t cancelled = 0;
+    for (size_t i = 0; i < cTIMERS; i += 7)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(wheel.Cancel(ids[i]));
+      RRLIB_UNIT_TESTS_ASSERT(!wheel.Cancel(ids[i]));
+      cancelled++;
+    }
+
+    size_t expired = 0;
+    while (wheel.Size() > 0)
+    {
+      now += tTime().FromNSec(std::uniform_int_distribution<long long>(1, 3000000)(random));
+      expired += wheel.Advance(now);
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(cTIMERS - cancelled, expired);
+    for (size_t i = 0; i < cTIMERS; i++)
+    {
+      if (i % 7 == 0)
+      {
+        RRLIB_UNIT_TESTS_ASSERT(fired[i].IsZero());
+        continue;
+      }
+      RRLIB_UNIT_TESTS_ASSERT(fired[i] >= deadlines[i] && fired[i] <= deadlines[i] + tTime(0, 3001));
+    }
+
+    // timers do not fire before their deadline (rounded up to resolution); callbacks may add timers; ids of expired timers are invalid
+    tTimerWheel::tTimerId follow_up = 0;
+    int calls = 0;
+    tTimerWheel::tTimerId first = wheel.AddTimeout(tTime::time_5ms, [&]()
+    {
+      calls++;
+      follow_up = wheel.AddTimeout(tTime::time_1ms, [&]()
+      {
+        calls++;
+      });
+    });
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), wheel.Advance(now + tTime(0, 4999)));
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(1), wheel.Advance(now + tTime(0, 5001)));
+    RRLIB_UNIT_TESTS_ASSERT(!wheel.Cancel(first));
+    RRLIB_UNIT_TESTS_EQUALITY(1, calls);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(1), wheel.Size());
+    RRLIB_UNIT_TESTS_ASSERT(wheel.Cancel(follow_up));
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), wheel.Advance(now + tTime::time_1s));
+    RRLIB_UNIT_TESTS_EQUALITY(1, calls);
+
+    // callbacks may call Advance()
+    now += tTime::time_1s;
+    calls = 0;
+    wheel.AddTimer(now + tTime::time_1ms, [&]()
+    {
+      calls++;
+      RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(1), wheel.Advance(now + tTime::time_20ms));
+    });
+    wheel.AddTimer(now + tTime::time_1ms, [&]()
+    {
+      calls++;
+    });
+    wheel.AddTimer(now + tTime::time_10ms, [&]()
+    {
+      calls++;
+    });
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(2), wheel.Advance(now + tTime::time_5ms));
+    RRLIB_UNIT_TESTS_EQUALITY(3, calls);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), wheel.Size());
+  }
+
+  void Histogram()
+  {
+    // buckets are contiguous and relative error is bounded
+    for (size_t i = 1; i < tLogLinearHistogram::cBUCKETS; i++)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(tLogLinearHistogram::BucketUpperBound(i - 1) + 1, tLogLinearHistogram::BucketLowerBound(i));
+      RRLIB_UNIT_TESTS_EQUALITY(i, tLogLinearHistogram::BucketIndex(tLogLinearHistogram::BucketLowerBound(i)));
+      RRLIB_UNIT_TESTS_ASSERT((tLogLinearHistogram::BucketUpperBound(i - 1) - tLogLinearHistogram::BucketLowerBound(i - 1)) * 16 <= tLogLinearHistogram::BucketLowerBound(i - 1));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(tLogLinearHistogram::cBUCKETS - 1, tLogLinearHistogram::BucketIndex(~0ull));
+
+    tLogLinearHistogram histogram;
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(0), histogram.Percentile(50));
+    for (uint64_t i = 1; i <= 1000; i++)
+    {
+      histogram.Add(i * 1000);
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(1000), histogram.Count());
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(1000), histogram.Min());
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(1000000), histogram.Max());
+    RRLIB_UNIT_TESTS_ASSERT(std::abs(static_cast<double>(histogram.Percentile(50)) - 500000) <= 500000 / 16);
+    RRLIB_UNIT_TESTS_ASSERT(std::abs(static_cast<double>(histogram.Percentile(99)) - 990000) <= 990000 / 16);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(1000000), histogram.Percentile(100));
+  }
+
+  void FrameStatistics()
+  {
+    tFPSComputer fps_computer(tTime(), 1000, 0);
+    tFrameTimeMonitor monitor(tTime::time_1s);
+    tTime now(1000, 0);
+    int completed_windows = 0;
+
+    // 100 Hz with every tenth frame 5 ms late
+    for (int i = 0; i <= 200; i++)
+    {
+      tTime frame_time = now + tTime::time_10ms * i + ((i % 10 == 5) ? tTime::time_5ms : tTime());
+      completed_windows += monitor.Frame(frame_time) ? 1 : 0;
+      fps_computer.IncrementFrameCounterAndCheckFPS(frame_time);
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(2, completed_windows);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(201), monitor.FrameCounter());
+    RRLIB_UNIT_TESTS_EQUALITY(201.0, fps_computer.FrameCounter());
+
+    const tFrameTimeStatistics& statistics = monitor.GetStatistics();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(100), statistics.frames);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime::time_1s, statistics.window);
+    RRLIB_UNIT_TESTS_ASSERT(std::abs(statistics.frame_rate - 100.0) < 0.001);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime::time_5ms, statistics.min_frame_time);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime::time_10ms * 1.5, statistics.max_frame_time);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime::time_10ms, statistics.mean_frame_time);
+    RRLIB_UNIT_TESTS_ASSERT(std::abs(statistics.p50_frame_time.ToNSec() - 10000000) <= 10000000 / 16);
+    RRLIB_UNIT_TESTS_ASSERT(std::abs(statistics.p99_frame_time.ToNSec() - 15000000) <= 15000000 / 16);
+    RRLIB_UNIT_TESTS_ASSERT(std::abs(statistics.jitter.ToNSec() - 2236068) < 1000);  // sqrt(0.1 * 2 * 5 ms^2)
+  }
+
+  void ConcurrentFPS()
+  {
+    tTime start(1000, 0);
+    tConcurrentFPSComputer fps_computer(start, 1000, 0);
+    const int cTHREADS = 8, cINCREMENTS = 100000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < cTHREADS; i++)
+    {
+      threads.emplace_back([&fps_computer]()
+      {
+        for (int j = 0; j < cINCREMENTS; j++)
+        {
+          fps_computer.IncrementFrameCounter();
+        }
+      });
+    }
+    for (auto & thread : threads)
+    {
+      thread.join();
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(cTHREADS * cINCREMENTS), fps_computer.FrameCounter());
+    RRLIB_UNIT_TESTS_ASSERT(!fps_computer.CheckFPS(start + tTime::time_500ms));
+    RRLIB_UNIT_TESTS_ASSERT(fps_computer.CheckFPS(start + tTime::time_2s));
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<float>(cTHREADS * cINCREMENTS / 2), fps_computer.FPS());
+  }
+
+  void ClockSynchronization()
+  {
+    // sensor clock starts at zero and runs 50 ppm slow; pairs are taken every 100 ms with up to 20 us noise
+    const tTime cHOST_START(1700000000, 0);
+    const double cRATE = 1.0 - 50e-6;
+    auto sensor_time = [&](const tTime & host_time)
+    {
+      return tTime().FromNSec(static_cast<long long>((host_time - cHOST_START).ToNSec() * cRATE));
+    };
+    std::mt19937 random(7);
+    std::uniform_int_distribution<long long> noise(-20000, 20000);
+
+    tClockSynchronization synchronization(32);
+    RRLIB_UNIT_TESTS_EQUALITY(tTime(5, 0), synchronization.Transform(tTime(5, 0)));
+    tTransformTime transform_time(tTime(), cHOST_START);
+    tTime host_time = cHOST_START;
+    for (int i = 0; i < 100; i++)
+    {
+      host_time += tTime::time_100ms;
+      tTime noisy_host_time = host_time + tTime().FromNSec(noise(random));
+      synchronization.AddSample(sensor_time(host_time), noisy_host_time);
+      transform_time.ChangeTimeBase(sensor_time(host_time), noisy_host_time);
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(32), synchronization.SampleCount());
+    RRLIB_UNIT_TESTS_ASSERT(std::abs(synchronization.GetSkew() - (1.0 / cRATE - 1.0)) < 2e-6);
+
+    // 10 s after the last pair, drift of 500 us is compensated
+    std::vector<tTime> times;
+    for (int i = 0; i < 1000; i++)
+    {
+      times.push_back(sensor_time(host_time + tTime::time_10s + tTime::time_1ms * i));
+    }
+    tTime transformed_single = synchronization.Transform(times[0]);
+    tTime transformed_offset_only = times[0];
+    transform_time.Transform(transformed_offset_only, tTime());
+    synchronization.Transform(times);
+    RRLIB_UNIT_TESTS_EQUALITY(transformed_single, times[0]);
+    for (int i = 0; i < 1000; i++)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(std::abs((times[i] - (host_time + tTime::time_10s + tTime::time_1ms * i)).ToNSec()) < 50000);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(std::abs((transformed_offset_only - (host_time + tTime::time_10s)).ToNSec()) > 400000);
+  }
+
 };
 
 RRLIB_UNIT_TESTS_REGISTER_SUITE(TestTime);
@@ -34,8 +34,10 @@
 #include "rrlib/util/tUnitTestSuite.h"
 
 #include <type_traits>
+#include <typeinfo>
 
 #include "rrlib/util/tTypeList.h"
+#include "rrlib/util/type_name.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -78,6 +80,7 @@ class TestTypeList : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(Append);
   RRLIB_UNIT_TESTS_ADD_TEST(Remove);
   RRLIB_UNIT_TESTS_ADD_TEST(Complex);
+  RRLIB_UNIT_TESTS_ADD_TEST(Names);
   RRLIB_UNIT_TESTS_END_SUITE;
 
 private:
@@ -107,6 +110,8 @@ private:
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tList::tAt<2>::tResult, B>::value));
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tList::tAt<3>::tResult, C>::value));
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tList::tAt<4>::tResult, D>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<int &, void, A>::tAt<0>::tResult, int &>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<int &, void, A>::tAt<1>::tResult, void>::value));
   }
 
   void IndexOf()
@@ -137,6 +142,9 @@ private:
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, B, C, D, E>::tRemove<B>::tResult, tTypeList<A, C, D, E>>::value));
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, C, D, E>::tRemove<D>::tResult, tTypeList<A, C, E>>::value));
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, C, B, C, D, E>::tRemoveAll<C>::tResult, tTypeList<A, B, D, E>>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, C>::tRemove<E>::tResult, tTypeList<A, C>>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<C, C>::tRemoveAll<C>::tResult, tTypeList<>>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<>::tRemove<C>::tResult, tTypeList<>>::value));
   }
 
   void Complex()
@@ -152,12 +160,33 @@ private:
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, B, B, A, C, B, A, A>::tUnique::tResult, tTypeList<A, B, C>>::value));
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, B, B>::tReplace<B, D>::tResult, tTypeList<A, D, B>>::value));
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, B, B>::tReplaceAll<B, D>::tResult, tTypeList<A, D, D>>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, B, B>::tReplace<C, D>::tResult, tTypeList<A, B, B>>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<void, int &, void, int>::tUnique::tResult, tTypeList<void, int &, int>>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<>::tUnique::tResult, tTypeList<>>::value));
 
     typedef tTypeList<A, B, C, D, E, Aa, Ab, Ac, Ba, Bb, Aba> tListWithDerived;
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tListWithDerived::tMostDerived<A>::tResult, Aba>::value));
 
     typedef tTypeList<Aba, Bb, C, D, E, Aa, Ab, Ac, Ba, B, A> tSortedList;
     RRLIB_UNIT_TESTS_ASSERT((std::is_same<tListWithDerived::tDerivedToFront::tResult, tSortedList>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<>::tMostDerived<A>::tResult, A>::value));
+    RRLIB_UNIT_TESTS_ASSERT((std::is_same<tTypeList<A, int, A, Aa>::tDerivedToFront::tResult, tTypeList<Aa, int, A, A>>::value));
+  }
+
+  void Names()
+  {
+    RRLIB_UNIT_TESTS_ASSERT(TypeName<int>() == "int");
+    RRLIB_UNIT_TESTS_ASSERT(TypeName<const char*>() == "const char*" || TypeName<const char*>() == "char const*");
+    RRLIB_UNIT_TESTS_ASSERT((TypeName<tTypeList<int, double>>() == Demangle(typeid(tTypeList<int, double>).name())));
+    RRLIB_UNIT_TESTS_ASSERT(TypeName<TestTypeList>() == "rrlib::util::TestTypeList");
+
+    typedef tTypeList<int, double, TestTypeList> tList;
+#ifdef RRLIB_UTIL_CONSTEXPR_TYPE_NAME
+    static_assert(TypeName<double>() == "double", "Type name must be available at compile time");
+    static_assert(tList::Names().size() == 3 && tList::Names()[2] == "rrlib::util::TestTypeList", "Type names must be available at compile time");
+#endif
+    RRLIB_UNIT_TESTS_ASSERT(tList::Names()[0] == "int" && tList::Names()[1] == "double");
+    RRLIB_UNIT_TESTS_ASSERT(tTypeList<>::Names().empty());
   }
 };
 
@@ -0,0 +1,124 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/tests/type_list_compile_benchmark.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * Instantiates all tTypeList algorithms for a list with
+ * RRLIB_UTIL_TYPE_LIST_BENCHMARK_SIZE distinct types.
+ *
+ * The interesting figures are the compile time and the memory the
+ * compiler needs. The target in make.xml only builds a small list (50
+ * types), so that normal test builds stay fast. Larger lists are
+ * measured manually - -ftime-report prints time and memory (TOTAL and
+ * GGC columns), e.g.:
+ *
+ *   g++ -std=c++17 -I<include path of rrlib> -fsyntax-only -ftime-report \
+ *       -DRRLIB_UTIL_TYPE_LIST_BENCHMARK_SIZE=1000 type_list_compile_benchmark.cpp
+ *
+ * (roughly 12 s and 1 GB with 1000 types and g++ 12)
+ * Running the program only checks the results.
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/tTypeList.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::util;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+#ifndef RRLIB_UTIL_TYPE_LIST_BENCHMARK_SIZE
+#define RRLIB_UTIL_TYPE_LIST_BENCHMARK_SIZE 50
+#endif
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t cSIZE = RRLIB_UTIL_TYPE_LIST_BENCHMARK_SIZE;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*! Distinct types for list (every type is derived from the one with half its index - so there are derivation chains for tMostDerived and tDerivedToFront) */
+template <size_t Tindex>
+struct tType : tType < Tindex / 2 >
+{};
+
+template <>
+struct tType<0>
+{};
+
+template <typename TSequence>
+struct tBenchmarkList;
+
+template <size_t ... Tindices>
+struct tBenchmarkList<std::index_sequence<Tindices...>>
+{
+  /*! List with cSIZE distinct types */
+  typedef tTypeList<tType<Tindices>...> tDistinct;
+
+  /*! List with cSIZE types - each type occurs twice */
+  typedef tTypeList < tType < Tindices % (cSIZE / 2) > ... > tDuplicates;
+};
+
+typedef tBenchmarkList<std::make_index_sequence<cSIZE>>::tDistinct tList;
+typedef tBenchmarkList<std::make_index_sequence<cSIZE>>::tDuplicates tListWithDuplicates;
+typedef tType < cSIZE - 1 > tLast;
+
+static_assert(tList::cSIZE == cSIZE, "Wrong size");
+static_assert(std::is_same<tList::tAt < cSIZE - 1 >::tResult, tLast>::value, "tAt failed");
+static_assert(tList::tIndexOf<tLast>::cVALUE == cSIZE - 1, "tIndexOf failed");
+static_assert(tList::tRemove<tLast>::tResult::cSIZE == cSIZE - 1, "tRemove failed");
+static_assert(tListWithDuplicates::tRemoveAll<tType<0>>::tResult::cSIZE == cSIZE - 2, "tRemoveAll failed");
+static_assert(tListWithDuplicates::tUnique::tResult::cSIZE == cSIZE / 2, "tUnique failed");
+static_assert(std::is_same<tListWithDuplicates::tReplaceAll<tType<0>, int>::tResult::tHead, int>::value, "tReplaceAll failed");
+static_assert(std::is_same<tList::tReplace<tLast, int>::tResult::tAt < cSIZE - 1 >::tResult, int>::value, "tReplace failed");
+static_assert(std::is_base_of<tType<1>, tList::tMostDerived<tType<1>>::tResult>::value, "tMostDerived failed");
+static_assert(tList::tDerivedToFront::tResult::cSIZE == cSIZE, "tDerivedToFront failed");
+
+int main()
+{
+  printf("Instantiated tTypeList algorithms for %zu types\n", cSIZE);
+  return 0;
+}
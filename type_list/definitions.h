@@ -41,6 +41,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <cstddef>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -68,6 +69,25 @@ typedef tTypeList<> tEmptyList;
 
 const size_t cNOT_IN_LIST = static_cast<size_t>(-1);
 
+namespace internal
+{
+
+/*! Value representing an arbitrary type (also void, references or abstract classes) in unevaluated expressions */
+template <typename T>
+struct tTypeWrapper
+{
+  typedef T tType;
+};
+
+/*! Every type gets a distinct address &tTypeId<T>::cID, which can be compared in constexpr functions */
+template <typename T>
+struct tTypeId
+{
+  static constexpr char cID = 0;
+};
+
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -72,17 +72,12 @@ namespace type_list
  *
  */
 template <typename TList, typename TListToAppend>
-class tAppendList
-{
-  typedef typename tAppend<TList, typename TListToAppend::tHead>::tResult tListWithHead;
-public:
-  typedef typename tAppendList<tListWithHead, typename TListToAppend::tTail>::tResult tResult;
-};
+struct tAppendList;
 
-template <typename TList>
-struct tAppendList<TList, tEmptyList>
+template <typename ... TListTypes, typename ... TTypesToAppend>
+struct tAppendList<tTypeList<TListTypes...>, tTypeList<TTypesToAppend...>>
 {
-  typedef TList tResult;
+  typedef tTypeList<TListTypes..., TTypesToAppend...> tResult;
 };
 
 //----------------------------------------------------------------------
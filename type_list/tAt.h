@@ -41,6 +41,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <utility>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -67,20 +68,42 @@ namespace type_list
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
+namespace internal
+{
+
+template <size_t Tindex, typename T>
+struct tIndexedType
+{};
+
+/*!
+ * Derives from tIndexedType<i, Ti> for every element Ti - so that the
+ * element at a given index is found by template argument deduction
+ * instead of walking through the list
+ */
+template <typename TIndices, typename ... TTypes>
+struct tIndexedTypes;
+
+template <size_t ... Tindices, typename ... TTypes>
+struct tIndexedTypes<std::index_sequence<Tindices...>, TTypes...> : tIndexedType<Tindices, TTypes>...
+{};
+
+template <size_t Tindex, typename T>
+tTypeWrapper<T> LookUp(const tIndexedType<Tindex, T> &);
+
+}
+
 //!
 /*!
  *
  */
 template <typename TList, size_t Tindex>
-struct tAt
-{
-  typedef typename tAt < typename TList::tTail, Tindex - 1 >::tResult tResult;
-};
+struct tAt;
 
-template <typename TList>
-struct tAt<TList, 0>
+template <typename ... TTypes, size_t Tindex>
+struct tAt<tTypeList<TTypes...>, Tindex>
 {
-  typedef typename TList::tHead tResult;
+  static_assert(Tindex < sizeof...(TTypes), "Index out of range");
+  typedef typename decltype(internal::LookUp<Tindex>(std::declval<internal::tIndexedTypes<std::index_sequence_for<TTypes...>, TTypes...>>()))::tType tResult;
 };
 
 //----------------------------------------------------------------------
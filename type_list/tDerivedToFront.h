@@ -41,6 +41,9 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <array>
+#include <type_traits>
+#include <utility>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -67,24 +70,84 @@ namespace type_list
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
+namespace internal
+{
+
+/*! \return For every T in TTypes: is T derived from TBase? */
+template <typename TBase, typename ... TTypes>
+constexpr std::array<bool, sizeof...(TTypes)> DerivedFrom()
+{
+  // __is_base_of is what std::is_base_of uses internally - but it does not instantiate a class template for each of the N * N pairs
+  return {{ __is_base_of(TBase, TTypes)... }};
+}
+
+/*!
+ * Same algorithm as the former recursive implementation: for every position i,
+ * the most derived type from element i in the rest of the list (see tMostDerived)
+ * is swapped to position i.
+ *
+ * \param derived derived[b][d] tells whether element d is derived from element b
+ *
+ * \return Indices of the elements in the sorted list
+ */
+template <size_t Tsize>
+constexpr std::array<size_t, Tsize> DerivedToFront(const std::array<std::array<bool, Tsize>, Tsize> &derived)
+{
+  size_t order[Tsize + 1] = {};  // raw arrays keep the constexpr operation count low enough for long lists
+  for (size_t i = 0; i < Tsize; i++)
+  {
+    order[i] = i;
+  }
+  for (size_t i = 0; i < Tsize; i++)
+  {
+    size_t most_derived = i;
+    const bool *derived_from_candidate = derived[order[i]].data();
+    for (size_t j = Tsize - 1; j > i; j--)
+    {
+      if (derived_from_candidate[order[j]])
+      {
+        most_derived = j;
+        derived_from_candidate = derived[order[j]].data();
+      }
+    }
+    size_t head = order[i];
+    order[i] = order[most_derived];
+    order[most_derived] = head;
+  }
+  std::array<size_t, Tsize> result {};
+  for (size_t i = 0; i < Tsize; i++)
+  {
+    result[i] = order[i];
+  }
+  return result;
+}
+
+}
+
 //!
 /*!
  *
  */
 template <typename TList>
-class tDerivedToFront
-{
-  typedef typename tMostDerived<typename TList::tTail, typename TList::tHead>::tResult tMostDerivedFromHeadInTail;
-  typedef typename tReplace<typename TList::tTail, tMostDerivedFromHeadInTail, typename TList::tHead>::tResult tProcessedTail;
-  typedef typename tDerivedToFront<tProcessedTail>::tResult tSortedTail;
-public:
-  typedef typename tAppendList<tTypeList<tMostDerivedFromHeadInTail>, tSortedTail>::tResult tResult;
-};
+struct tDerivedToFront;
 
-template <>
-struct tDerivedToFront<tEmptyList>
+template <typename ... TTypes>
+class tDerivedToFront<tTypeList<TTypes...>>
 {
-  typedef tEmptyList tResult;
+  static constexpr std::array<std::array<bool, sizeof...(TTypes)>, sizeof...(TTypes)> cDERIVED = {{ internal::DerivedFrom<TTypes, TTypes...>()... }};
+  static constexpr std::array<size_t, sizeof...(TTypes)> cORDER = internal::DerivedToFront<sizeof...(TTypes)>(cDERIVED);
+
+  template <typename TIndices>
+  struct tHelper;
+
+  template <size_t ... Tindices>
+  struct tHelper<std::index_sequence<Tindices...>>
+  {
+    typedef tTypeList<typename tAt<tTypeList<TTypes...>, cORDER[Tindices]>::tResult...> tResult;
+  };
+
+public:
+  typedef typename tHelper<std::index_sequence_for<TTypes...>>::tResult tResult;
 };
 
 //----------------------------------------------------------------------
@@ -0,0 +1,112 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/type_list/tFilter.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tFilter
+ *
+ * \b tFilter
+ *
+ * Removes elements from a type list depending on a flag per element
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__type_list__include_guard__
+#error Invalid include directive. Try #include "rrlib/util/tTypeList.h" instead.
+#endif
+
+#ifndef __rrlib__util__type_lists__tFilter_h__
+#define __rrlib__util__type_lists__tFilter_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+namespace type_list
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+namespace internal
+{
+
+/*! Lightweight type list for intermediate results (tTypeList with its tTypeListBase is more expensive to instantiate) */
+template <typename ... TTypes>
+struct tPack
+{
+  typedef tTypeList<TTypes...> tList;
+};
+
+template <typename ... TLeft, typename ... TRight>
+tPack<TLeft..., TRight...> operator + (tPack<TLeft...>, tPack<TRight...>);
+
+//!
+/*!
+ * tResult contains the elements of TList whose flag in Tkeep is true.
+ * The kept elements are concatenated by a single fold expression instead
+ * of a recursion on the tail of TList.
+ */
+template <typename TList, bool ... Tkeep>
+class tFilter;
+
+template <typename ... TTypes, bool ... Tkeep>
+class tFilter<tTypeList<TTypes...>, Tkeep...>
+{
+  static_assert(sizeof...(TTypes) == sizeof...(Tkeep), "Need exactly one flag per element");
+public:
+  typedef typename decltype((tPack<>() + ... + typename std::conditional<Tkeep, tPack<TTypes>, tPack<>>::type()))::tList tResult;
+};
+
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#endif
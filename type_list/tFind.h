@@ -41,6 +41,8 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <array>
+#include <type_traits>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -67,28 +69,38 @@ namespace type_list
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
+namespace internal
+{
+
+/*! \return Index of first element in values[0, size) that equals value or cNOT_IN_LIST */
+template <typename T, size_t Tsize>
+constexpr size_t Find(const std::array<T, Tsize> &values, size_t size, const T &value)
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    if (values[i] == value)
+    {
+      return i;
+    }
+  }
+  return cNOT_IN_LIST;
+}
+
+}
+
 //!
 /*!
  *
  */
 template <typename TList, typename T>
-class tFind
-{
-  static const size_t cINDEX_IN_TAIL = tFind<typename TList::tTail, T>::cINDEX;
-public:
-  static const size_t cINDEX = cINDEX_IN_TAIL == cNOT_IN_LIST ? cNOT_IN_LIST : cINDEX_IN_TAIL + 1;
-};
+struct tFind;
 
-template <typename T>
-struct tFind<tEmptyList, T>
+template <typename ... TTypes, typename T>
+class tFind<tTypeList<TTypes...>, T>
 {
-  static const size_t cINDEX = cNOT_IN_LIST;
-};
-
-template <typename TList>
-struct tFind<TList, typename TList::tHead>
-{
-  static const size_t cINDEX = 0;
+  static constexpr std::array<bool, sizeof...(TTypes)> cMATCHES = {{ std::is_same<TTypes, T>::value... }};
+public:
+  static const size_t cINDEX = internal::Find(cMATCHES, sizeof...(TTypes), true);
 };
 
 //----------------------------------------------------------------------
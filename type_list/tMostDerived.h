@@ -68,44 +68,38 @@ namespace type_list
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
-//!
-/*!
- *
- */
-namespace
+namespace internal
 {
 
-template <bool, typename TThen, typename TElse>
-struct tIfThenElse
+template <typename TCandidate>
+struct tMostDerivedCandidate
 {
-  typedef TThen tResult;
+  typedef TCandidate tType;
 };
 
-template <typename TThen, typename TElse>
-struct tIfThenElse<false, TThen, TElse>
-{
-  typedef TElse tResult;
-};
+/*! One step of tMostDerived: T replaces the candidate if it is derived from it */
+template <typename T, typename TCandidate>
+tMostDerivedCandidate<typename std::conditional<std::is_base_of<TCandidate, T>::value, T, TCandidate>::type> operator + (tTypeWrapper<T>, tMostDerivedCandidate<TCandidate>);
 
 }
 
+//!
+/*!
+ * Starting with TBase, the list is scanned from back to front and every
+ * type derived from the current candidate becomes the new candidate.
+ * This is a right fold over the list instead of a recursion on its tail.
+ */
 template <typename TList, typename TBase>
-class tMostDerived
-{
-  typedef typename tMostDerived<typename TList::tTail, TBase>::tResult tCandidate;
-  static const bool cHEAD_DERIVED_FROM_CANDIDATE = std::is_base_of<tCandidate, typename TList::tHead>::value;
-public:
-  typedef typename tIfThenElse<cHEAD_DERIVED_FROM_CANDIDATE, typename TList::tHead, tCandidate>::tResult tResult;
-};
+struct tMostDerived;
 
-template <typename TBase>
-struct tMostDerived<tEmptyList, TBase>
+template <typename ... TTypes, typename TBase>
+struct tMostDerived<tTypeList<TTypes...>, TBase>
 {
-  typedef TBase tResult;
+  typedef typename decltype((internal::tTypeWrapper<TTypes>() + ... + internal::tMostDerivedCandidate<TBase>()))::tType tResult;
 };
 
 //----------------------------------------------------------------------
-// End of namespace declartMostDerivedion
+// End of namespace declaration
 //----------------------------------------------------------------------
 }
 }
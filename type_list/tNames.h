@@ -0,0 +1,100 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/type_list/tNames.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief   Contains tNames
+ *
+ * \b tNames
+ *
+ * Static table with the names (see TypeName) of all types in a type list
+ * - generated at compile time with GCC and Clang.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__type_list__include_guard__
+#error Invalid include directive. Try #include "rrlib/util/tTypeList.h" instead.
+#endif
+
+#ifndef __rrlib__util__type_lists__tNames_h__
+#define __rrlib__util__type_lists__tNames_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <array>
+#include <string_view>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/type_name.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+namespace type_list
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//!
+/*!
+ * cVALUE[i] is the name of the i-th type in TList
+ */
+template <typename TList>
+struct tNames;
+
+template <typename ... TTypes>
+struct tNames<tTypeList<TTypes...>>
+{
+#ifdef RRLIB_UTIL_CONSTEXPR_TYPE_NAME
+  static constexpr std::array<std::string_view, sizeof...(TTypes)> cVALUE = {{ TypeName<TTypes>()... }};
+#else
+  static inline const std::array<std::string_view, sizeof...(TTypes)> cVALUE = {{ TypeName<TTypes>()... }};
+#endif
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#endif
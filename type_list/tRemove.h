@@ -41,6 +41,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <utility>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -72,23 +73,24 @@ namespace type_list
  *
  */
 template <typename TList, typename T>
-class tRemove
-{
-  typedef typename tRemove<typename TList::tTail, T>::tResult tProcessedTail;
-public:
-  typedef typename tAppendList<tTypeList<typename TList::tHead>, tProcessedTail>::tResult tResult;
-};
+struct tRemove;
 
-template <typename T>
-struct tRemove<tEmptyList, T>
+template <typename ... TTypes, typename T>
+class tRemove<tTypeList<TTypes...>, T>
 {
-  typedef tEmptyList tResult;
-};
+  static const size_t cINDEX = tFind<tTypeList<TTypes...>, T>::cINDEX;
 
-template <typename TList>
-struct tRemove<TList, typename TList::tHead>
-{
-  typedef typename TList::tTail tResult;
+  template <typename TIndices>
+  struct tHelper;
+
+  template <size_t ... Tindices>
+  struct tHelper<std::index_sequence<Tindices...>>
+  {
+    typedef typename internal::tFilter<tTypeList<TTypes...>, (Tindices != cINDEX)...>::tResult tResult;
+  };
+
+public:
+  typedef typename tHelper<std::index_sequence_for<TTypes...>>::tResult tResult;
 };
 
 //----------------------------------------------------------------------
@@ -41,6 +41,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <type_traits>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -72,23 +73,12 @@ namespace type_list
  *
  */
 template <typename TList, typename T>
-class tRemoveAll
-{
-  typedef typename tRemoveAll<typename TList::tTail, T>::tResult tTailWithoutT;
-public:
-  typedef typename tAppendList<tTypeList<typename TList::tHead>, tTailWithoutT>::tResult tResult;
-};
-
-template <typename T>
-struct tRemoveAll<tEmptyList, T>
-{
-  typedef tEmptyList tResult;
-};
+struct tRemoveAll;
 
-template <typename TList>
-struct tRemoveAll<TList, typename TList::tHead>
+template <typename ... TTypes, typename T>
+struct tRemoveAll<tTypeList<TTypes...>, T>
 {
-  typedef typename tRemoveAll<typename TList::tTail, typename TList::tHead>::tResult tResult;
+  typedef typename internal::tFilter<tTypeList<TTypes...>, !std::is_same<TTypes, T>::value...>::tResult tResult;
 };
 
 //----------------------------------------------------------------------
@@ -41,6 +41,8 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <type_traits>
+#include <utility>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -72,23 +74,24 @@ namespace type_list
  *
  */
 template <typename TList, typename TOld, typename TNew>
-class tReplace
-{
-  typedef typename tReplace<typename TList::tTail, TOld, TNew>::tResult tProcessedTail;
-public:
-  typedef typename tAppendList<tTypeList<typename TList::tHead>, tProcessedTail>::tResult tResult;
-};
+struct tReplace;
 
-template <typename TOld, typename TNew>
-struct tReplace<tEmptyList, TOld, TNew>
+template <typename ... TTypes, typename TOld, typename TNew>
+class tReplace<tTypeList<TTypes...>, TOld, TNew>
 {
-  typedef tEmptyList tResult;
-};
+  static const size_t cINDEX = tFind<tTypeList<TTypes...>, TOld>::cINDEX;
 
-template <typename TList, typename TNew>
-struct tReplace<TList, typename TList::tHead, TNew>
-{
-  typedef typename tAppendList<tTypeList<TNew>, typename TList::tTail>::tResult tResult;
+  template <typename TIndices>
+  struct tHelper;
+
+  template <size_t ... Tindices>
+  struct tHelper<std::index_sequence<Tindices...>>
+  {
+    typedef tTypeList<typename std::conditional<Tindices == cINDEX, TNew, TTypes>::type...> tResult;
+  };
+
+public:
+  typedef typename tHelper<std::index_sequence_for<TTypes...>>::tResult tResult;
 };
 
 //----------------------------------------------------------------------
@@ -41,6 +41,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <type_traits>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -72,25 +73,12 @@ namespace type_list
  *
  */
 template <typename TList, typename TOld, typename TNew>
-class tReplaceAll
-{
-  typedef typename tReplaceAll<typename TList::tTail, TOld, TNew>::tResult tProcessedTail;
-public:
-  typedef typename tAppendList<tTypeList<typename TList::tHead>, tProcessedTail>::tResult tResult;
-};
-
-template <typename TOld, typename TNew>
-struct tReplaceAll<tEmptyList, TOld, TNew>
-{
-  typedef tEmptyList tResult;
-};
+struct tReplaceAll;
 
-template <typename TList, typename TNew>
-class tReplaceAll<TList, typename TList::tHead, TNew>
+template <typename ... TTypes, typename TOld, typename TNew>
+struct tReplaceAll<tTypeList<TTypes...>, TOld, TNew>
 {
-  typedef typename tReplaceAll<typename TList::tTail, typename TList::tHead, TNew>::tResult tProcessedTail;
-public:
-  typedef typename tAppendList<tTypeList<TNew>, tProcessedTail>::tResult tResult;
+  typedef tTypeList<typename std::conditional<std::is_same<TTypes, TOld>::value, TNew, TTypes>::type...> tResult;
 };
 
 //----------------------------------------------------------------------
@@ -72,15 +72,12 @@ namespace type_list
  *
  */
 template <typename TList>
-struct tSizeOf
-{
-  static const size_t cVALUE = tSizeOf<typename TList::tTail>::cVALUE + 1;
-};
+struct tSizeOf;
 
-template <>
-struct tSizeOf<tEmptyList>
+template <typename ... TTypes>
+struct tSizeOf<tTypeList<TTypes...>>
 {
-  static const size_t cVALUE = 0;
+  static const size_t cVALUE = sizeof...(TTypes);
 };
 
 //----------------------------------------------------------------------
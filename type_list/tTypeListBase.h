@@ -139,6 +139,12 @@ struct tTypeListBase
   {
     typedef typename type_list::tDerivedToFront<TList>::tResult tResult;
   };
+
+  /*! \return Names of all types in list (static table) */
+  static RRLIB_UTIL_TYPE_NAME_CONSTEXPR const auto &Names()
+  {
+    return type_list::tNames<TList>::cVALUE;
+  }
 };
 
 template <typename TList>
@@ -41,6 +41,8 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <array>
+#include <utility>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -67,23 +69,63 @@ namespace type_list
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
+namespace internal
+{
+
+/*! \return For every element in ids: is it the first element with this value? */
+template <size_t Tsize>
+constexpr std::array<bool, Tsize> FirstOccurrences(const std::array<const void *, Tsize> &ids)
+{
+  const void *values[Tsize + 1] = {};  // raw arrays keep the constexpr operation count low enough for long lists
+  bool first[Tsize + 1] = {};
+  for (size_t i = 0; i < Tsize; i++)
+  {
+    values[i] = ids[i];
+    first[i] = true;
+    for (size_t j = 0; j < i; j++)
+    {
+      if (values[j] == values[i])
+      {
+        first[i] = false;
+        break;
+      }
+    }
+  }
+  std::array<bool, Tsize> result {};
+  for (size_t i = 0; i < Tsize; i++)
+  {
+    result[i] = first[i];
+  }
+  return result;
+}
+
+}
+
 //!
 /*!
- *
+ * Keeps the first occurrence of every type.
+ * Types are compared via the addresses of tTypeId<T>::cID, which needs one
+ * instantiation per type instead of one std::is_same per pair of types.
  */
 template <typename TList>
-class tUnique
-{
-  typedef typename tRemoveAll<typename TList::tTail, typename TList::tHead>::tResult tTailWithoutHead;
-  typedef typename tUnique<tTailWithoutHead>::tResult tUniqueTailWithoutHead;
-public:
-  typedef typename tAppendList<tTypeList<typename TList::tHead>, tUniqueTailWithoutHead>::tResult tResult;
-};
+struct tUnique;
 
-template <>
-struct tUnique<tEmptyList>
+template <typename ... TTypes>
+class tUnique<tTypeList<TTypes...>>
 {
-  typedef tEmptyList tResult;
+  static constexpr std::array<bool, sizeof...(TTypes)> cFIRST = internal::FirstOccurrences<sizeof...(TTypes)>({{ &internal::tTypeId<TTypes>::cID... }});
+
+  template <typename TIndices>
+  struct tHelper;
+
+  template <size_t ... Tindices>
+  struct tHelper<std::index_sequence<Tindices...>>
+  {
+    typedef typename internal::tFilter<tTypeList<TTypes...>, cFIRST[Tindices]...>::tResult tResult;
+  };
+
+public:
+  typedef typename tHelper<std::index_sequence_for<TTypes...>>::tResult tResult;
 };
 
 //----------------------------------------------------------------------
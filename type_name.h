@@ -0,0 +1,131 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/util/type_name.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-19
+ *
+ * \brief Contains TypeName
+ *
+ * \b TypeName
+ *
+ * Provides the human-readable name of a type - computed by the compiler.
+ *
+ * Demangling typeid(T).name() at runtime is expensive (see demangle.h)
+ * and adds up in type registries that name hundreds of types on startup.
+ * With GCC and Clang, TypeName<T>() extracts the name from
+ * __PRETTY_FUNCTION__ at compile time instead. The returned string_view
+ * points to static storage (it is not null-terminated).
+ *
+ * Names follow the compiler's pretty-printing - which may differ from
+ * the demangled RTTI name for templates with default arguments (e.g.
+ * GCC prints "std::vector<int>" instead of
+ * "std::vector<int, std::allocator<int> >").
+ *
+ * With other compilers, TypeName falls back to DemangleCached (and is
+ * not constexpr).
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__util__type_name_h__
+#define __rrlib__util__type_name_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string_view>
+#include <typeinfo>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/util/demangle.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace util
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+#if defined(__GNUC__) || defined(__clang__)
+#define RRLIB_UTIL_CONSTEXPR_TYPE_NAME 1
+#define RRLIB_UTIL_TYPE_NAME_CONSTEXPR constexpr
+#else
+#define RRLIB_UTIL_TYPE_NAME_CONSTEXPR
+#endif
+
+namespace internal
+{
+#ifdef RRLIB_UTIL_CONSTEXPR_TYPE_NAME
+/*! \return Signature of this function - containing the name of T */
+template <typename T>
+constexpr std::string_view TypeNameSignature()
+{
+  return __PRETTY_FUNCTION__;
+}
+
+/*! Number of characters before the type name in TypeNameSignature (determined with a known type) */
+constexpr size_t cTYPE_NAME_PREFIX = TypeNameSignature<double>().find("double");
+
+/*! Number of characters after the type name in TypeNameSignature */
+constexpr size_t cTYPE_NAME_SUFFIX = TypeNameSignature<double>().length() - cTYPE_NAME_PREFIX - std::string_view("double").length();
+
+static_assert(cTYPE_NAME_PREFIX != std::string_view::npos, "Unsupported format of __PRETTY_FUNCTION__");
+#endif
+}
+
+//----------------------------------------------------------------------
+// Function declaration
+//----------------------------------------------------------------------
+
+/*!
+ * \tparam T Type whose name to obtain
+ *
+ * \return Name of T (e.g. "rrlib::util::tTime") with static storage duration
+ */
+template <typename T>
+inline RRLIB_UTIL_TYPE_NAME_CONSTEXPR std::string_view TypeName()
+{
+#ifdef RRLIB_UTIL_CONSTEXPR_TYPE_NAME
+  std::string_view signature = internal::TypeNameSignature<T>();
+  return signature.substr(internal::cTYPE_NAME_PREFIX, signature.length() - internal::cTYPE_NAME_PREFIX - internal::cTYPE_NAME_SUFFIX);
+#else
+  return DemangleCached(typeid(T).name());
+#endif
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif